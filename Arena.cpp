@@ -0,0 +1,103 @@
+/**
+ * Arena.cpp
+ *
+ * Implementations for the MonotonicArena class, which hands out
+ * memory from large slabs and frees every slab at once.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cstdint>
+#include <new>
+#include "Arena.h"
+
+/**
+ * Constructor for MonotonicArena class
+ *
+ * @param   slabSize   number of bytes in each slab
+ */
+MonotonicArena::MonotonicArena(std::size_t slabSize) :
+   slabSize(slabSize), currentSlab(nullptr), nextByte(nullptr),
+   endByte(nullptr), slabCount(0) {}
+
+/**
+ * Destructor for MonotonicArena class that frees all slabs.
+ *
+ * Calls MonotonicArena::clear() method.
+ */
+MonotonicArena::~MonotonicArena() {
+   clear();
+}
+
+/**
+ * Retrieves memory for the specified number of bytes. Requests
+ * larger than the slab size receive a slab of their own.
+ *
+ * @pre                 MonotonicArena must be initialized
+ *
+ * @post                memory stays valid until clear() is called
+ *                      or this MonotonicArena is destructed
+ *
+ * @param   bytes       number of bytes to allocate
+ * @param   alignment   required alignment, a power of two
+ *
+ * @return              address of the allocated memory
+ */
+void* MonotonicArena::allocate(std::size_t bytes, std::size_t alignment) {
+   std::uintptr_t address = reinterpret_cast<std::uintptr_t>(nextByte);
+   std::uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+
+   if (currentSlab == nullptr ||
+      aligned + bytes > reinterpret_cast<std::uintptr_t>(endByte)) {
+      // start a new slab, large enough for oversized requests
+      std::size_t needed = sizeof(Slab) + alignment + bytes;
+      std::size_t size = needed > slabSize ? needed : slabSize;
+
+      Slab* slab = static_cast<Slab*>(::operator new(size));
+      slab->previous = currentSlab;
+      currentSlab = slab;
+      slabCount++;
+
+      nextByte = reinterpret_cast<char*>(slab + 1);
+      endByte = reinterpret_cast<char*>(slab) + size;
+
+      address = reinterpret_cast<std::uintptr_t>(nextByte);
+      aligned = (address + alignment - 1) & ~(alignment - 1);
+   }
+
+   nextByte = reinterpret_cast<char*>(aligned + bytes);
+   return reinterpret_cast<void*>(aligned);
+}
+
+/**
+ * Frees all slabs of this MonotonicArena at once
+ *
+ * @pre     memory handed out by this MonotonicArena is no longer
+ *          in use
+ *
+ * @post    this MonotonicArena holds no slabs
+ */
+void MonotonicArena::clear() {
+   while (currentSlab != nullptr) {
+      Slab* previous = currentSlab->previous;
+      ::operator delete(currentSlab);
+      currentSlab = previous;
+   }
+
+   nextByte = nullptr;
+   endByte = nullptr;
+   slabCount = 0;
+}
+
+/**
+ * Retrieves the number of slabs currently held
+ *
+ * @pre     MonotonicArena must be initialized
+ *
+ * @post    state of this MonotonicArena does not change
+ *
+ * @return  number of slabs
+ */
+int MonotonicArena::getSlabCount() const {
+   return slabCount;
+} // end Arena.cpp
@@ -0,0 +1,173 @@
+/**
+ * Arena.h
+ *
+ * Declarations for the MonotonicArena class, which hands out memory
+ * from large slabs and frees every slab at once, and for the
+ * ArenaAllocator class, which lets containers such as Queue and
+ * Node<T> lists draw their memory from a MonotonicArena.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+
+/**
+ * Represents a monotonic memory arena. Allocations are carved out of
+ * slabs in order and are never freed individually; clear() and the
+ * destructor release all slabs at once.
+ */
+class MonotonicArena {
+public:
+   /**
+    * Constructor for MonotonicArena class
+    *
+    * @param   slabSize   number of bytes in each slab
+    */
+   explicit MonotonicArena(std::size_t slabSize = 1 << 20);
+
+   /**
+    * Destructor for MonotonicArena class that frees all slabs.
+    *
+    * Calls MonotonicArena::clear() method.
+    */
+   ~MonotonicArena();
+
+   MonotonicArena(const MonotonicArena&) = delete;
+   MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+   /**
+    * Retrieves memory for the specified number of bytes. Requests
+    * larger than the slab size receive a slab of their own.
+    *
+    * @pre                 MonotonicArena must be initialized
+    *
+    * @post                memory stays valid until clear() is called
+    *                      or this MonotonicArena is destructed
+    *
+    * @param   bytes       number of bytes to allocate
+    * @param   alignment   required alignment, a power of two
+    *
+    * @return              address of the allocated memory
+    */
+   void* allocate(std::size_t bytes, std::size_t alignment);
+
+   /**
+    * Frees all slabs of this MonotonicArena at once
+    *
+    * @pre     memory handed out by this MonotonicArena is no longer
+    *          in use
+    *
+    * @post    this MonotonicArena holds no slabs
+    */
+   void clear();
+
+   /**
+    * Retrieves the number of slabs currently held
+    *
+    * @pre     MonotonicArena must be initialized
+    *
+    * @post    state of this MonotonicArena does not change
+    *
+    * @return  number of slabs
+    */
+   int getSlabCount() const;
+
+private:
+   /**
+    * Header stored at the start of every slab, linking the slabs
+    * held by this MonotonicArena
+    */
+   struct Slab {
+      /** slab allocated before this one, otherwise nullptr */
+      Slab* previous;
+   };
+
+   /** number of bytes in each slab */
+   std::size_t slabSize;
+   /** most recently allocated slab, otherwise nullptr */
+   Slab* currentSlab;
+   /** next free byte in the current slab */
+   char* nextByte;
+   /** one past the last byte of the current slab */
+   char* endByte;
+   /** number of slabs held */
+   int slabCount;
+};
+
+/**
+ * Represents an allocator that obtains memory from a MonotonicArena.
+ * Deallocation does nothing; memory is reclaimed when the arena is
+ * cleared.
+ */
+template<class T>
+class ArenaAllocator {
+public:
+   typedef T value_type;
+
+   /**
+    * Constructor for ArenaAllocator class
+    *
+    * @param   arena   MonotonicArena providing memory
+    */
+   ArenaAllocator(MonotonicArena& arena) : arena(&arena) {}
+
+   /**
+    * Converting constructor for ArenaAllocator class, which shares
+    * the MonotonicArena of an allocator for another type
+    *
+    * @param   other   allocator whose arena is shared
+    */
+   template<class U>
+   ArenaAllocator(const ArenaAllocator<U>& other) :
+      arena(other.getArena()) {}
+
+   /**
+    * Retrieves memory for the specified number of values
+    *
+    * @param   count   number of values to allocate
+    *
+    * @return          address of the allocated memory
+    */
+   T* allocate(std::size_t count) {
+      return static_cast<T*>(arena->allocate(sizeof(T) * count,
+         alignof(T)));
+   }
+
+   /**
+    * Releases memory for values, which is reclaimed only when the
+    * arena is cleared
+    */
+   void deallocate(T*, std::size_t) {}
+
+   /**
+    * Retrieves the MonotonicArena providing memory
+    *
+    * @return  arena of this allocator
+    */
+   MonotonicArena* getArena() const {
+      return arena;
+   }
+
+private:
+   /** MonotonicArena providing memory */
+   MonotonicArena* arena;
+};
+
+/**
+ * Determines if two ArenaAllocators share the same MonotonicArena
+ */
+template<class T, class U>
+bool operator==(const ArenaAllocator<T>& lhs,
+   const ArenaAllocator<U>& rhs) {
+   return lhs.getArena() == rhs.getArena();
+}
+
+/**
+ * Determines if two ArenaAllocators use different MonotonicArenas
+ */
+template<class T, class U>
+bool operator!=(const ArenaAllocator<T>& lhs,
+   const ArenaAllocator<U>& rhs) {
+   return lhs.getArena() != rhs.getArena();
+} // end Arena.h
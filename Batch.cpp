@@ -0,0 +1,169 @@
+/**
+ * Batch.cpp
+ *
+ * Implementations for running many Koch curve jobs in one process.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include "Batch.h"
+#include "CurveWriter.h"
+#include "KochGenerator.h"
+#include "ThreadPool.h"
+
+namespace {
+   /** highest level a job may draw, the same as a server request */
+   const int MAX_JOB_LEVEL = 12;
+
+   /**
+    * Writes the curve of a job to its file
+    *
+    * @return      number of points written
+    *
+    * @throw       std::exception if the curve cannot be written
+    */
+   std::uint64_t runJob(const BatchJob& job, TemplateCache* templates) {
+      std::uint64_t pointCount = (1ULL << (2 * job.level)) + 1;
+
+      std::ofstream file(job.path, std::ios::binary);
+      if (!file) {
+         throw std::runtime_error("Cannot write " + job.path);
+      }
+
+      std::unique_ptr<PointSink> writer = createWriter(job.format, file,
+         job.end, pointCount, false);
+
+      if (templates != nullptr) {
+         writer->begin(job.start, job.level);
+         templates->drawKoch(job.start, job.end, job.level, *writer);
+         writer->end();
+      }
+      else {
+         KochGenerator generator(job.start.getXCoord(),
+            job.start.getYCoord(), job.end.getXCoord(),
+            job.end.getYCoord(), job.level, KochOptions::streamed());
+         generator.generate(*writer);
+      }
+
+      file.close();
+      if (!file) {
+         throw std::runtime_error("Cannot write " + job.path);
+      }
+      return pointCount;
+   }
+}
+
+/**
+ * Reads a job from one line of a job list
+ *
+ * @param   line     line of the job list
+ *
+ * @return           the job
+ *
+ * @throw   std::invalid_argument if the line is not a valid job
+ */
+BatchJob parseBatchJob(const std::string& line) {
+   std::istringstream fields(line);
+   double x1, y1, x2, y2;
+   BatchJob job;
+
+   if (!(fields >> x1 >> y1 >> x2 >> y2 >> job.level >> job.path)) {
+      throw std::invalid_argument("Job must be x1 y1 x2 y2 level path "
+         "[format]");
+   }
+   if (!(fields >> job.format)) {
+      job.format = "ps";
+   }
+
+   std::string extra;
+   if (fields >> extra) {
+      throw std::invalid_argument("Unexpected field " + extra);
+   }
+   if (job.level < 0 || job.level > MAX_JOB_LEVEL) {
+      throw std::invalid_argument("Koch curve level must be between 0 and " +
+         std::to_string(MAX_JOB_LEVEL));
+   }
+   // checked before the job's file is opened and truncated
+   if (!isWriterFormat(job.format)) {
+      throw std::invalid_argument("Unknown format " + job.format);
+   }
+
+   job.start = Point(x1, y1);
+   job.end = Point(x2, y2);
+   return job;
+}
+
+/**
+ * Runs every job of a job list on a pool of threads and reports the
+ * status of each job as it finishes
+ *
+ * @pre                    threadCount is at least 1
+ *
+ * @post                   every valid job's curve is written to its
+ *                         path
+ *
+ * @param   jobs           input stream holding the job list
+ * @param   status         output stream receiving the status lines
+ * @param   threadCount    number of jobs run at a time
+ * @param   templates      cache drawing every curve, or nullptr to
+ *                         draw them recursively
+ *
+ * @return                 number of jobs that failed
+ */
+int runBatch(std::istream& jobs, std::ostream& status, int threadCount,
+   TemplateCache* templates) {
+
+   std::atomic<int> failures(0);
+   std::mutex statusLock;
+
+   // status lines are written whole, in the order jobs finish
+   auto report = [&status, &statusLock](int lineNumber,
+      const std::string& message) {
+      std::lock_guard<std::mutex> guard(statusLock);
+      status << lineNumber << '\t' << message << std::endl;
+   };
+
+   ThreadPool pool(threadCount);
+   std::string line;
+   int lineNumber = 0;
+
+   while (std::getline(jobs, line)) {
+      lineNumber++;
+
+      std::size_t first = line.find_first_not_of(" \t\r");
+      if (first == std::string::npos || line[first] == '#') {
+         continue;
+      }
+
+      BatchJob job;
+      try {
+         job = parseBatchJob(line);
+      }
+      catch (const std::invalid_argument& error) {
+         failures++;
+         report(lineNumber, std::string("error\t") + error.what());
+         continue;
+      }
+
+      pool.submit([job, lineNumber, templates, &failures, &report] {
+         try {
+            std::uint64_t pointCount = runJob(job, templates);
+            report(lineNumber, "ok\t" + job.path + '\t' +
+               std::to_string(pointCount));
+         }
+         catch (const std::exception& error) {
+            failures++;
+            report(lineNumber, std::string("error\t") + error.what());
+         }
+      });
+   }
+
+   pool.wait();
+   return failures;
+} // end Batch.cpp
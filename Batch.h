@@ -0,0 +1,76 @@
+/**
+ * Batch.h
+ *
+ * Declarations for running many Koch curve jobs in one process. Each
+ * line of a job list describes one curve
+ *
+ *    x1 y1 x2 y2 level path [format]
+ *
+ * where level is between 0 and 12 and format is one of the
+ * createWriter formats, ps by default. Both are checked before the
+ * job's file is opened.
+ * Blank lines and lines starting with # are skipped. Jobs run
+ * concurrently on one ThreadPool and may share one TemplateCache.
+ * A status line is reported for every job as it finishes
+ *
+ *    <line number>  ok     <path>  <number of points>
+ *    <line number>  error  <message>
+ *
+ * with the fields separated by tabs.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include "Point.h"
+#include "TemplateCache.h"
+
+/**
+ * Represents one curve of a batch
+ */
+struct BatchJob {
+   /** first point of the curve */
+   Point start;
+   /** last point of the curve */
+   Point end;
+   /** Koch level of the curve */
+   int level;
+   /** path of the file to write the curve to */
+   std::string path;
+   /** output format of the curve */
+   std::string format;
+};
+
+/**
+ * Reads a job from one line of a job list
+ *
+ * @param   line     line of the job list
+ *
+ * @return           the job
+ *
+ * @throw   std::invalid_argument if the line is not a valid job
+ */
+BatchJob parseBatchJob(const std::string& line);
+
+/**
+ * Runs every job of a job list on a pool of threads and reports the
+ * status of each job as it finishes
+ *
+ * @pre                    threadCount is at least 1
+ *
+ * @post                   every valid job's curve is written to its
+ *                         path
+ *
+ * @param   jobs           input stream holding the job list
+ * @param   status         output stream receiving the status lines
+ * @param   threadCount    number of jobs run at a time
+ * @param   templates      cache drawing every curve, or nullptr to
+ *                         draw them recursively
+ *
+ * @return                 number of jobs that failed
+ */
+int runBatch(std::istream& jobs, std::ostream& status, int threadCount,
+   TemplateCache* templates);
+// end Batch.h
@@ -0,0 +1,396 @@
+/**
+ * Benchmark.cpp
+ *
+ * Microbenchmarks of curve generation, Queue operations, Point
+ * arithmetic and PostScript output, written to standard output as
+ * JSON. Built and run by bench_script.sh:
+ *
+ *    bench_runner [--quick] [--compare baseline.json [--tolerance P]]
+ *
+ * --quick measures levels 0 to 8 with shorter samples. --compare
+ * reads the output of an earlier run, reports the change of every
+ * benchmark on standard error and exits with status 1 if any got
+ * worse by more than P percent, 50 by default. Repeat runs of one
+ * binary on a shared machine differ by up to about a third, so the
+ * default only catches clear slowdowns. Every result is one
+ * line of the "results" array
+ *
+ *    {"name": "drawKoch/level=5", "unit": "points/s", "value": 1e+08, 
+ *     "better": "higher"}
+ *
+ * Every benchmark is sampled eleven times and the median sample is
+ * reported, which keeps the numbers stable enough to compare.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "KochGenerator.h"
+#include "Point.h"
+#include "PointSink.h"
+#include "PostScriptWriter.h"
+#include "Queue.h"
+
+/**
+ * Represents the result of one benchmark
+ */
+struct BenchResult {
+   /** name of the benchmark */
+   std::string name;
+   /** unit of the value */
+   std::string unit;
+   /** measured value */
+   double value;
+   /** true if higher values are better */
+   bool higherIsBetter;
+};
+
+/**
+ * Represents a PointSink that only counts the Points it receives
+ */
+class CountingSink : public PointSink {
+public:
+   void begin(const Point& firstPoint, int level) {
+      count++;
+   }
+
+   void addPoint(const Point& point) {
+      count++;
+   }
+
+   void end() {}
+
+   /** number of Points received */
+   long long count = 0;
+};
+
+/**
+ * Represents an output stream buffer that discards its output and
+ * counts the bytes
+ */
+class CountingBuffer : public std::streambuf {
+public:
+   /** number of bytes written */
+   long long count = 0;
+
+protected:
+   std::streamsize xsputn(const char* text, std::streamsize length) {
+      count += length;
+      return length;
+   }
+
+   int overflow(int character) {
+      count++;
+      return character;
+   }
+};
+
+/** number of samples of every benchmark */
+const int SAMPLE_COUNT = 11;
+
+/** shortest time of one sample in seconds */
+double sampleSeconds = 0.2;
+
+/**
+ * Measures the median rate of an operation over SAMPLE_COUNT 
+ * samples. Every sample repeats the operation until it has run for
+ * sampleSeconds. An operation with a preparation is timed alone, 
+ * after its preparation has run untimed.
+ *
+ * @param   operation   runs once and returns the amount of work done
+ * @param   prepare     runs untimed before every operation, or is 
+ *                      empty
+ *
+ * @return              median amount of work per second
+ */
+double medianRate(const std::function<double()>& operation,
+   const std::function<void()>& prepare = std::function<void()>()) {
+   std::vector<double> rates;
+
+   for (int sample = 0; sample < SAMPLE_COUNT; sample++) {
+      double work = 0;
+      double seconds = 0;
+
+      if (prepare) {
+         do {
+            prepare();
+            auto start = std::chrono::steady_clock::now();
+            work += operation();
+            seconds += std::chrono::duration<double>(
+               std::chrono::steady_clock::now() - start).count();
+         } while (seconds < sampleSeconds);
+      }
+      else {
+         // time the whole sample, so fast operations are not 
+         // dominated by reading the clock
+         auto start = std::chrono::steady_clock::now();
+         do {
+            work += operation();
+            seconds = std::chrono::duration<double>(
+               std::chrono::steady_clock::now() - start).count();
+         } while (seconds < sampleSeconds);
+      }
+
+      rates.push_back(work / seconds);
+   }
+
+   // the median ignores samples disturbed by the rest of the system
+   std::nth_element(rates.begin(), rates.begin() + rates.size() / 2,
+      rates.end());
+   return rates[rates.size() / 2];
+}
+
+/**
+ * Measures the recursion and the generation of whole curves in 
+ * points per second
+ */
+void benchGeneration(int maxLevel, std::vector<BenchResult>& results) {
+   for (int level = 0; level <= maxLevel; level++) {
+      KochGenerator generator(72, 360, 504, 360, level,
+         KochOptions::streamed());
+
+      double rate = medianRate([&]() {
+         CountingSink sink;
+         generator.drawKoch(72, 360, 504, 360, level, sink);
+         return (double) sink.count;
+      });
+      results.push_back({ "drawKoch/level=" + std::to_string(level), 
+         "points/s", rate, true });
+
+      rate = medianRate([&]() {
+         CountingSink sink;
+         generator.generate(sink);
+         return (double) sink.count;
+      });
+      results.push_back({ "generate/level=" + std::to_string(level), 
+         "points/s", rate, true });
+   }
+}
+
+/**
+ * Measures pushing, popping and copying a Queue<Point> in Points
+ * per second
+ */
+void benchQueue(std::vector<BenchResult>& results) {
+   const int count = 1 << 20;
+   Queue<Point> full;
+   for (int i = 0; i < count; i++) {
+      full.push(Point(i, -i));
+   }
+
+   double rate = medianRate([&]() {
+      Queue<Point> queue;
+      for (int i = 0; i < count; i++) {
+         queue.push(Point(i, -i));
+      }
+      return (double) queue.getCurrentSize();
+   });
+   results.push_back({ "queue/push", "points/s", rate, true });
+
+   // popping is timed alone, on a copy made untimed before each run
+   Queue<Point> queue;
+   rate = medianRate([&]() {
+      double sum = 0;
+      while (!queue.isEmpty()) {
+         sum += queue.front().getXCoord();
+         queue.pop();
+      }
+      return sum >= 0 ? (double) count : 0;
+   }, [&]() {
+      queue = full;
+   });
+   results.push_back({ "queue/pop", "points/s", rate, true });
+
+   double copyRate = medianRate([&]() {
+      Queue<Point> queue(full);
+      return (double) queue.getCurrentSize();
+   });
+   results.push_back({ "queue/copy", "points/s", copyRate, true });
+}
+
+/**
+ * Measures Point::section and Point::rotate in nanoseconds per call
+ */
+void benchPoint(std::vector<BenchResult>& results) {
+   const int count = 1 << 16;
+   Point reference(504, 360);
+
+   double rate = medianRate([&]() {
+      Point point(72, 360);
+      for (int i = 0; i < count; i++) {
+         point = point.section(1, 2, reference);
+      }
+      return point.getXCoord() > 0 ? (double) count : 0;
+   });
+   results.push_back({ "point/section", "ns/op", 1e9 / rate, false });
+
+   rate = medianRate([&]() {
+      Point point(72, 360);
+      for (int i = 0; i < count; i++) {
+         point = point.rotate(60, reference);
+      }
+      return point.getXCoord() > 0 ? (double) count : 0;
+   });
+   results.push_back({ "point/rotate", "ns/op", 1e9 / rate, false });
+}
+
+/**
+ * Measures streamed PostScript output in megabytes per second
+ */
+void benchPostScript(int maxLevel, std::vector<BenchResult>& results) {
+   for (int level = 0; level <= maxLevel; level++) {
+      KochGenerator generator(72, 360, 504, 360, level,
+         KochOptions::streamed());
+
+      double rate = medianRate([&]() {
+         CountingBuffer buffer;
+         std::ostream output(&buffer);
+         output << generator;
+         output.flush();
+         return buffer.count / 1e6;
+      });
+      results.push_back({ "postscript/level=" + std::to_string(level), 
+         "MB/s", rate, true });
+   }
+}
+
+/**
+ * Writes results as JSON, one result per line
+ */
+void writeResults(const std::vector<BenchResult>& results, 
+   std::ostream& output) {
+
+   output << "{\n  \"version\": 1,\n  \"results\": [\n";
+   for (std::size_t i = 0; i < results.size(); i++) {
+      const BenchResult& result = results[i];
+      output << "    {\"name\": \"" << result.name << "\", \"unit\": \"" 
+         << result.unit << "\", \"value\": " << result.value 
+         << ", \"better\": \"" << (result.higherIsBetter ? "higher" : 
+         "lower") << "\"}" << (i + 1 < results.size() ? "," : "") 
+         << "\n";
+   }
+   output << "  ]\n}\n";
+}
+
+/**
+ * Retrieves the text of a string field of a result line
+ */
+std::string stringField(const std::string& line, const std::string& key) {
+   std::string marker = "\"" + key + "\": \"";
+   std::size_t start = line.find(marker);
+   if (start == std::string::npos) {
+      return "";
+   }
+   start += marker.size();
+   return line.substr(start, line.find('"', start) - start);
+}
+
+/**
+ * Reads the values of the results of an earlier run by name
+ *
+ * @throw   std::runtime_error if the file cannot be read
+ */
+std::map<std::string, double> readBaseline(const std::string& path) {
+   std::ifstream input(path);
+   if (!input) {
+      throw std::runtime_error("Cannot read baseline " + path);
+   }
+
+   std::map<std::string, double> values;
+   std::string line;
+   while (std::getline(input, line)) {
+      std::string name = stringField(line, "name");
+      std::size_t value = line.find("\"value\": ");
+      if (!name.empty() && value != std::string::npos) {
+         values[name] = std::strtod(line.c_str() + value + 9, nullptr);
+      }
+   }
+   return values;
+}
+
+/**
+ * Reports the change of every result against the baseline on 
+ * standard error
+ *
+ * @return  number of results worse by more than the tolerance
+ */
+int compareResults(const std::vector<BenchResult>& results,
+   const std::map<std::string, double>& baseline, double tolerance) {
+
+   int regressions = 0;
+   for (const BenchResult& result : results) {
+      auto found = baseline.find(result.name);
+      if (found == baseline.end() || !(found->second > 0)) {
+         std::cerr << result.name << "\tnew" << std::endl;
+         continue;
+      }
+
+      // speedup above 1 is better, whichever way the unit points
+      double speedup = result.higherIsBetter ? 
+         result.value / found->second : found->second / result.value;
+      bool regressed = speedup < 1 - tolerance / 100;
+      regressions += regressed;
+
+      std::cerr << result.name << "\t" << found->second << " -> " 
+         << result.value << " " << result.unit << "\t" 
+         << (speedup - 1) * 100 << "%" 
+         << (regressed ? "\tREGRESSION" : "") << std::endl;
+   }
+   return regressions;
+}
+
+int main(int argc, char* argv[]) {
+   int maxLevel = 12;
+   std::string baselinePath;
+   double tolerance = 50;
+
+   for (int i = 1; i < argc; i++) {
+      std::string option = argv[i];
+      if (option == "--quick") {
+         maxLevel = 8;
+         sampleSeconds = 0.02;
+      }
+      else if (option == "--compare" && i + 1 < argc) {
+         baselinePath = argv[++i];
+      }
+      else if (option == "--tolerance" && i + 1 < argc) {
+         tolerance = std::atof(argv[++i]);
+      }
+      else {
+         std::cerr << "Usage: bench_runner [--quick] "
+            "[--compare baseline.json [--tolerance P]]" << std::endl;
+         return 2;
+      }
+   }
+
+   // read the baseline first, so that a bad path fails fast
+   std::map<std::string, double> baseline;
+   if (!baselinePath.empty()) {
+      baseline = readBaseline(baselinePath);
+   }
+
+   std::vector<BenchResult> results;
+   benchGeneration(maxLevel, results);
+   benchQueue(results);
+   benchPoint(results);
+   benchPostScript(maxLevel, results);
+   writeResults(results, std::cout);
+
+   if (!baselinePath.empty() && 
+      compareResults(results, baseline, tolerance) > 0) {
+      return 1;
+   }
+   return 0;
+} // end Benchmark.cpp
@@ -0,0 +1,426 @@
+/**
+ * BinaryCurve.cpp
+ *
+ * Implementations for the BinaryCurveWriter and BinaryCurveReader
+ * classes, which write and read Koch curves in a compact binary
+ * format.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include "BinaryCurve.h"
+
+namespace {
+   /** first bytes of every binary curve */
+   const char MAGIC[4] = { 'K', 'O', 'C', 'H' };
+   /** format version written by this implementation */
+   const int VERSION = 1;
+   /** most bytes one point can take: two 10 byte varints */
+   const std::size_t MAX_POINT_SIZE = 20;
+   /** size of the header in bytes */
+   const std::size_t HEADER_SIZE = 56;
+
+   static_assert(MAX_POINT_SIZE <= OutputBuffer::MAX_LINE_SIZE &&
+      HEADER_SIZE <= OutputBuffer::MAX_LINE_SIZE,
+      "a point or the header must fit in one reserved line");
+
+   /**
+    * Retrieves the bits of a double
+    */
+   std::uint64_t bitsOf(double value) {
+      std::uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return bits;
+   }
+
+   /**
+    * Retrieves the bits of a float
+    */
+   std::uint64_t bitsOf(float value) {
+      std::uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return bits;
+   }
+
+   /**
+    * Retrieves the double with the specified bits
+    */
+   double doubleOf(std::uint64_t bits) {
+      double value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+   }
+
+   /**
+    * Retrieves the float with the specified bits
+    */
+   float floatOf(std::uint64_t bits) {
+      std::uint32_t lowBits = (std::uint32_t) bits;
+      float value;
+      std::memcpy(&value, &lowBits, sizeof(value));
+      return value;
+   }
+}
+
+/**
+ * Constructor for BinaryCurveWriter class
+ *
+ * @param   output      output stream to write the curve to
+ * @param   encoding    encoding of the points
+ * @param   lastPoint   last point of the curve, for the header
+ * @param   pointCount  number of points including the first, or
+ *                      UNKNOWN_POINT_COUNT
+ */
+BinaryCurveWriter::BinaryCurveWriter(std::ostream& output,
+   CurveEncoding encoding, const Point& lastPoint,
+   std::uint64_t pointCount) :
+   BinaryCurveWriter(output, encoding, lastPoint, pointCount, false) {}
+
+/**
+ * Constructor for BinaryCurveWriter class. The header is written
+ * before any point, so whether the path is closed must be known 
+ * up front.
+ *
+ * @param   output      output stream to write the curve to
+ * @param   encoding    encoding of the points
+ * @param   lastPoint   last point of the curve, for the header
+ * @param   pointCount  number of points including the first, or
+ *                      UNKNOWN_POINT_COUNT
+ * @param   closed      true if the path will be closed
+ */
+BinaryCurveWriter::BinaryCurveWriter(std::ostream& output,
+   CurveEncoding encoding, const Point& lastPoint,
+   std::uint64_t pointCount, bool closed) :
+   buffer(output), output(output), encoding(encoding), 
+   lastPoint(lastPoint), pointCount(pointCount), closed(closed), 
+   absolute(false), priorXCoord(0), priorYCoord(0) {}
+
+/**
+ * Writes the header of the curve
+ *
+ * @pre                 no Points have been added to this writer
+ *
+ * @post                header is sent to the output stream
+ *
+ * @param   firstPoint  first point of the Koch curve
+ * @param   level       Koch level of the curve
+ */
+void BinaryCurveWriter::begin(const Point& firstPoint, int level) {
+   buffer.reserveLine();
+   buffer.appendText(MAGIC, 4);
+   writeBytes(VERSION, 1);
+   writeBytes(encoding, 1);
+   writeBytes(closed ? CLOSED_PATH_FLAG : 0, 2);
+   writeBytes((std::uint32_t) level, 4);
+   writeBytes(0, 4);
+   writeBytes(pointCount, 8);
+   writeBytes(bitsOf(firstPoint.getXCoord()), 8);
+   writeBytes(bitsOf(firstPoint.getYCoord()), 8);
+   writeBytes(bitsOf(lastPoint.getXCoord()), 8);
+   writeBytes(bitsOf(lastPoint.getYCoord()), 8);
+
+   absolute = level == 0;
+   priorXCoord = firstPoint.getXCoord();
+   priorYCoord = firstPoint.getYCoord();
+}
+
+/**
+ * Writes the next Point of the Koch curve
+ *
+ * @pre              begin() has been called
+ *
+ * @post             Point is sent to the output stream
+ *
+ * @param   point    next Point of the Koch curve
+ */
+void BinaryCurveWriter::addPoint(const Point& point) {
+   buffer.reserveLine();
+
+   if (encoding == FLOAT64) {
+      writeBytes(bitsOf(point.getXCoord()), 8);
+      writeBytes(bitsOf(point.getYCoord()), 8);
+   }
+   else if (encoding == FLOAT32) {
+      writeBytes(bitsOf((float) point.getXCoord()), 4);
+      writeBytes(bitsOf((float) point.getYCoord()), 4);
+   }
+   else if (absolute) {
+      writeVarint(std::llround(point.getXCoord()));
+      writeVarint(std::llround(point.getYCoord()));
+   }
+   else {
+      // same integers as the rlineto lines of PostScriptWriter
+      writeVarint(std::llround(point.getXCoord() - priorXCoord));
+      writeVarint(std::llround(point.getYCoord() - priorYCoord));
+   }
+
+   priorXCoord = point.getXCoord();
+   priorYCoord = point.getYCoord();
+}
+
+/**
+ * Flushes all buffered bytes to the output stream
+ *
+ * @pre     begin() has been called
+ *
+ * @post    all points are sent to the output stream
+ */
+void BinaryCurveWriter::end() {
+   buffer.flush();
+   output.flush();
+}
+
+/**
+ * Appends a signed integer as a zig-zag varint
+ *
+ * @param   value    integer to append
+ */
+void BinaryCurveWriter::writeVarint(std::int64_t value) {
+   // zig-zag maps small magnitudes of either sign to small codes
+   std::uint64_t code = ((std::uint64_t) value << 1) ^
+      (std::uint64_t) (value >> 63);
+
+   while (code >= 0x80) {
+      buffer.appendChar((char) (code | 0x80));
+      code >>= 7;
+   }
+   buffer.appendChar((char) code);
+}
+
+/**
+ * Appends the low bytes of an unsigned integer, little-endian
+ *
+ * @param   value    integer to append
+ * @param   size     number of bytes to append
+ */
+void BinaryCurveWriter::writeBytes(std::uint64_t value, int size) {
+   for (int i = 0; i < size; i++) {
+      buffer.appendChar((char) (value >> (8 * i)));
+   }
+}
+
+/**
+ * Constructor for BinaryCurveReader class, which reads the header
+ *
+ * @param   input    input stream holding the curve
+ *
+ * @throw   std::runtime_error if the header is missing or invalid
+ */
+BinaryCurveReader::BinaryCurveReader(std::istream& input) :
+   input(input.rdbuf()), pointsRead(1) {
+
+   char magic[4];
+   std::uint64_t version, encodingCode, flags, reserved, level;
+   std::uint64_t x1, y1, x2, y2;
+
+   if (this->input->sgetn(magic, 4) != 4 ||
+      std::memcmp(magic, MAGIC, 4) != 0) {
+      throw std::runtime_error("Input is not a binary Koch curve");
+   }
+   if (!readBytes(version, 1) || !readBytes(encodingCode, 1) ||
+      !readBytes(flags, 2) || !readBytes(level, 4) ||
+      !readBytes(reserved, 4) || !readBytes(pointCount, 8) ||
+      !readBytes(x1, 8) || !readBytes(y1, 8) || !readBytes(x2, 8) ||
+      !readBytes(y2, 8)) {
+      throw std::runtime_error("Binary Koch curve header is truncated");
+   }
+   if (version != VERSION || encodingCode > FLOAT64) {
+      throw std::runtime_error("Unsupported binary Koch curve version");
+   }
+
+   encoding = (CurveEncoding) encodingCode;
+   closed = (flags & CLOSED_PATH_FLAG) != 0;
+   curveLevel = (int) (std::int32_t) level;
+   firstPoint = Point(doubleOf(x1), doubleOf(y1));
+   lastPoint = Point(doubleOf(x2), doubleOf(y2));
+   priorXCoord = firstPoint.getXCoord();
+   priorYCoord = firstPoint.getYCoord();
+}
+
+/**
+ * Retrieves the encoding of the points
+ *
+ * @return  encoding of the points
+ */
+CurveEncoding BinaryCurveReader::getEncoding() const {
+   return encoding;
+}
+
+/**
+ * Retrieves the Koch level of the curve
+ *
+ * @return  Koch curve level
+ */
+int BinaryCurveReader::getCurveLevel() const {
+   return curveLevel;
+}
+
+/**
+ * Retrieves the number of points including the first
+ *
+ * @return  number of points, or UNKNOWN_POINT_COUNT
+ */
+std::uint64_t BinaryCurveReader::getPointCount() const {
+   return pointCount;
+}
+
+/**
+ * Determines if the path returns to its first point
+ *
+ * @return  true if the path is closed
+ */
+bool BinaryCurveReader::isClosed() const {
+   return closed;
+}
+
+/**
+ * Retrieves the first point of the curve
+ *
+ * @return  first point of the curve
+ */
+Point BinaryCurveReader::getFirstPoint() const {
+   return firstPoint;
+}
+
+/**
+ * Retrieves the last point of the curve
+ *
+ * @return  last point of the curve
+ */
+Point BinaryCurveReader::getLastPoint() const {
+   return lastPoint;
+}
+
+/**
+ * Reads the next point after the first. Points of DELTA_VARINT
+ * curves are rebuilt from the rounded integers, so they produce
+ * the same PostScript lines as the original points.
+ *
+ * @pre              BinaryCurveReader must be initialized
+ *
+ * @post             point is consumed from the input stream
+ *
+ * @param   point    receives the next point
+ *
+ * @return           true if a point was read, false at the end
+ *                   of the curve
+ *
+ * @throw   std::runtime_error if the curve ends early
+ */
+bool BinaryCurveReader::readPoint(Point& point) {
+   if (pointsRead == pointCount) {
+      return false;
+   }
+   if (pointCount == UNKNOWN_POINT_COUNT &&
+      input->sgetc() == std::char_traits<char>::eof()) {
+      return false;
+   }
+
+   bool complete;
+   if (encoding == DELTA_VARINT) {
+      std::int64_t xVal, yVal;
+      complete = readVarint(xVal) && readVarint(yVal);
+
+      if (curveLevel == 0) {
+         point = Point((double) xVal, (double) yVal);
+      }
+      else {
+         point = Point(priorXCoord + xVal, priorYCoord + yVal);
+      }
+   }
+   else {
+      int size = encoding == FLOAT64 ? 8 : 4;
+      std::uint64_t xBits, yBits;
+      complete = readBytes(xBits, size) && readBytes(yBits, size);
+
+      if (encoding == FLOAT64) {
+         point = Point(doubleOf(xBits), doubleOf(yBits));
+      }
+      else {
+         point = Point(floatOf(xBits), floatOf(yBits));
+      }
+   }
+
+   if (!complete) {
+      throw std::runtime_error("Binary Koch curve is truncated");
+   }
+
+   priorXCoord = point.getXCoord();
+   priorYCoord = point.getYCoord();
+   pointsRead++;
+   return true;
+}
+
+/**
+ * Reads the remaining points into the specified PointSink,
+ * starting with begin(), closing the path if it is closed and
+ * finishing with end()
+ *
+ * @pre            no points have been read
+ *
+ * @post           all points are consumed from the input stream
+ *
+ * @param   sink   PointSink receiving the points of the curve
+ */
+void BinaryCurveReader::read(PointSink& sink) {
+   sink.begin(firstPoint, curveLevel);
+
+   Point point;
+   while (readPoint(point)) {
+      sink.addPoint(point);
+   }
+
+   if (closed) {
+      sink.closePath();
+   }
+   sink.end();
+}
+
+/**
+ * Reads a zig-zag varint
+ *
+ * @param   value    receives the integer read
+ *
+ * @return           false if the input ended before the varint
+ */
+bool BinaryCurveReader::readVarint(std::int64_t& value) {
+   std::uint64_t code = 0;
+
+   for (int shift = 0; shift < 64; shift += 7) {
+      int byte = input->sbumpc();
+      if (byte == std::char_traits<char>::eof()) {
+         return false;
+      }
+
+      code |= (std::uint64_t) (byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+         value = (std::int64_t) (code >> 1) ^ -(std::int64_t) (code & 1);
+         return true;
+      }
+   }
+   return false;
+}
+
+/**
+ * Reads a little-endian unsigned integer of the specified size
+ *
+ * @param   value    receives the integer read
+ * @param   size     number of bytes to read
+ *
+ * @return           false if the input ended before the integer
+ */
+bool BinaryCurveReader::readBytes(std::uint64_t& value, int size) {
+   value = 0;
+
+   for (int i = 0; i < size; i++) {
+      int byte = input->sbumpc();
+      if (byte == std::char_traits<char>::eof()) {
+         return false;
+      }
+      value |= (std::uint64_t) (unsigned char) byte << (8 * i);
+   }
+   return true;
+} // end BinaryCurve.cpp
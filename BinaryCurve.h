@@ -0,0 +1,283 @@
+/**
+ * BinaryCurve.h
+ *
+ * Declarations for the BinaryCurveWriter and BinaryCurveReader
+ * classes, which write and read Koch curves in a compact binary
+ * format. All values are little-endian. A 56 byte header
+ *
+ *    offset  0   "KOCH"
+ *    offset  4   uint8    format version, currently 1
+ *    offset  5   uint8    CurveEncoding of the points
+ *    offset  6   uint16   flags; bit 0 is set for a closed path
+ *    offset  8   int32    Koch level
+ *    offset 12   uint32   reserved, 0
+ *    offset 16   uint64   number of points including the first, or
+ *                         UNKNOWN_POINT_COUNT
+ *    offset 24   float64  x1, y1, x2, y2 end points of the curve
+ *
+ * is followed by every point after the first. DELTA_VARINT stores the
+ * integers of the PostScript lines: the rounded distance from the
+ * prior point, or the rounded point itself on level 0, as zig-zag
+ * varints. FLOAT64 stores the raw coordinates. FLOAT32 rounds every
+ * coordinate to the nearest float, which can move a point across a 
+ * PostScript rounding boundary, so only DELTA_VARINT and FLOAT64 
+ * curves are sure to convert back to the PostScript of the original
+ * curve. A closed path does not repeat its first point at the end.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include "OutputBuffer.h"
+#include "Point.h"
+#include "PointSink.h"
+
+/**
+ * Encodings of the points in a binary curve
+ */
+enum CurveEncoding {
+   /** rounded PostScript integers as zig-zag varints */
+   DELTA_VARINT = 0,
+   /** coordinates rounded to 32 bit floats, which is lossy */
+   FLOAT32 = 1,
+   /** coordinates as 64 bit floats */
+   FLOAT64 = 2
+};
+
+/** point count of a curve whose length was not known when written */
+const std::uint64_t UNKNOWN_POINT_COUNT = ~(std::uint64_t) 0;
+
+/** header flag of a curve that returns to its first point */
+const std::uint16_t CLOSED_PATH_FLAG = 1;
+
+/**
+ * Represents a PointSink that streams a Koch curve in binary format
+ */
+class BinaryCurveWriter : public PointSink {
+public:
+   /**
+    * Constructor for BinaryCurveWriter class
+    *
+    * @param   output      output stream to write the curve to
+    * @param   encoding    encoding of the points
+    * @param   lastPoint   last point of the curve, for the header
+    * @param   pointCount  number of points including the first, or
+    *                      UNKNOWN_POINT_COUNT
+    */
+   BinaryCurveWriter(std::ostream& output, CurveEncoding encoding,
+      const Point& lastPoint, std::uint64_t pointCount);
+
+   /**
+    * Constructor for BinaryCurveWriter class. The header is written
+    * before any point, so whether the path is closed must be known 
+    * up front.
+    *
+    * @param   output      output stream to write the curve to
+    * @param   encoding    encoding of the points
+    * @param   lastPoint   last point of the curve, for the header
+    * @param   pointCount  number of points including the first, or
+    *                      UNKNOWN_POINT_COUNT
+    * @param   closed      true if the path will be closed
+    */
+   BinaryCurveWriter(std::ostream& output, CurveEncoding encoding,
+      const Point& lastPoint, std::uint64_t pointCount, bool closed);
+
+   /**
+    * Writes the header of the curve
+    *
+    * @pre                 no Points have been added to this writer
+    *
+    * @post                header is sent to the output stream
+    *
+    * @param   firstPoint  first point of the Koch curve
+    * @param   level       Koch level of the curve
+    */
+   void begin(const Point& firstPoint, int level);
+
+   /**
+    * Writes the next Point of the Koch curve
+    *
+    * @pre              begin() has been called
+    *
+    * @post             Point is sent to the output stream
+    *
+    * @param   point    next Point of the Koch curve
+    */
+   void addPoint(const Point& point);
+
+   /**
+    * Flushes all buffered bytes to the output stream
+    *
+    * @pre     begin() has been called
+    *
+    * @post    all points are sent to the output stream
+    */
+   void end();
+
+private:
+   /**
+    * Appends a signed integer as a zig-zag varint
+    *
+    * @param   value    integer to append
+    */
+   void writeVarint(std::int64_t value);
+
+   /**
+    * Appends the low bytes of an unsigned integer, little-endian
+    *
+    * @param   value    integer to append
+    * @param   size     number of bytes to append
+    */
+   void writeBytes(std::uint64_t value, int size);
+
+   /** bytes encoded but not yet written to the output stream */
+   OutputBuffer buffer;
+   /** output stream to write the curve to */
+   std::ostream& output;
+   /** encoding of the points */
+   CurveEncoding encoding;
+   /** last point of the curve */
+   Point lastPoint;
+   /** number of points including the first */
+   std::uint64_t pointCount;
+   /** true if the path will be closed */
+   bool closed;
+   /** true if varints hold rounded points instead of distances */
+   bool absolute;
+   /** X coordinate of the prior Point */
+   double priorXCoord;
+   /** Y coordinate of the prior Point */
+   double priorYCoord;
+};
+
+/**
+ * Represents a reader of Koch curves in binary format
+ */
+class BinaryCurveReader {
+public:
+   /**
+    * Constructor for BinaryCurveReader class, which reads the header
+    *
+    * @param   input    input stream holding the curve
+    *
+    * @throw   std::runtime_error if the header is missing or invalid
+    */
+   explicit BinaryCurveReader(std::istream& input);
+
+   /**
+    * Retrieves the encoding of the points
+    *
+    * @return  encoding of the points
+    */
+   CurveEncoding getEncoding() const;
+
+   /**
+    * Retrieves the Koch level of the curve
+    *
+    * @return  Koch curve level
+    */
+   int getCurveLevel() const;
+
+   /**
+    * Retrieves the number of points including the first
+    *
+    * @return  number of points, or UNKNOWN_POINT_COUNT
+    */
+   std::uint64_t getPointCount() const;
+
+   /**
+    * Determines if the path returns to its first point
+    *
+    * @return  true if the path is closed
+    */
+   bool isClosed() const;
+
+   /**
+    * Retrieves the first point of the curve
+    *
+    * @return  first point of the curve
+    */
+   Point getFirstPoint() const;
+
+   /**
+    * Retrieves the last point of the curve
+    *
+    * @return  last point of the curve
+    */
+   Point getLastPoint() const;
+
+   /**
+    * Reads the next point after the first. Points of DELTA_VARINT
+    * curves are rebuilt from the rounded integers, so they produce
+    * the same PostScript lines as the original points.
+    *
+    * @pre              BinaryCurveReader must be initialized
+    *
+    * @post             point is consumed from the input stream
+    *
+    * @param   point    receives the next point
+    *
+    * @return           true if a point was read, false at the end
+    *                   of the curve
+    *
+    * @throw   std::runtime_error if the curve ends early
+    */
+   bool readPoint(Point& point);
+
+   /**
+    * Reads the remaining points into the specified PointSink,
+    * starting with begin(), closing the path if it is closed and
+    * finishing with end()
+    *
+    * @pre            no points have been read
+    *
+    * @post           all points are consumed from the input stream
+    *
+    * @param   sink   PointSink receiving the points of the curve
+    */
+   void read(PointSink& sink);
+
+private:
+   /**
+    * Reads a zig-zag varint
+    *
+    * @param   value    receives the integer read
+    *
+    * @return           false if the input ended before the varint
+    */
+   bool readVarint(std::int64_t& value);
+
+   /**
+    * Reads a little-endian unsigned integer of the specified size
+    *
+    * @param   value    receives the integer read
+    * @param   size     number of bytes to read
+    *
+    * @return           false if the input ended before the integer
+    */
+   bool readBytes(std::uint64_t& value, int size);
+
+   /** buffer of the input stream holding the curve */
+   std::streambuf* input;
+   /** encoding of the points */
+   CurveEncoding encoding;
+   /** Koch curve level */
+   int curveLevel;
+   /** number of points including the first */
+   std::uint64_t pointCount;
+   /** true if the path returns to its first point */
+   bool closed;
+   /** number of points read including the first */
+   std::uint64_t pointsRead;
+   /** first point of the curve */
+   Point firstPoint;
+   /** last point of the curve */
+   Point lastPoint;
+   /** X coordinate of the prior point */
+   double priorXCoord;
+   /** Y coordinate of the prior point */
+   double priorYCoord;
+}; // end BinaryCurve.h
@@ -0,0 +1,140 @@
+/**
+ * BreadthFirstGenerator.cpp
+ *
+ * Implementations for the BreadthFirstGenerator class, which
+ * generates a Koch curve level by level with SIMD kernels.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <stdexcept>
+#include "BreadthFirstGenerator.h"
+
+namespace {
+   /** number of levels expanded per tile, 4^8 segments or 2 MB */
+   const int TILE_LEVEL = 8;
+}
+
+/**
+ * Constructor for BreadthFirstGenerator class, which uses the
+ * fastest kernel the processor supports
+ *
+ * @param   x1    X coordinate of first point
+ * @param   y1    Y coordinate of first point
+ * @param   x2    X coordinate of second point
+ * @param   y2    Y coordinate of second point
+ * @param   level Koch level to draw
+ */
+BreadthFirstGenerator::BreadthFirstGenerator(double x1, double y1,
+   double x2, double y2, int level) :
+   BreadthFirstGenerator(x1, y1, x2, y2, level, bestKochKernelName()) {}
+
+/**
+ * Constructor for BreadthFirstGenerator class, which uses the
+ * specified kernel
+ *
+ * @param   x1          X coordinate of first point
+ * @param   y1          Y coordinate of first point
+ * @param   x2          X coordinate of second point
+ * @param   y2          Y coordinate of second point
+ * @param   level       Koch level to draw
+ * @param   kernelName  "scalar", "sse2" or "avx2"
+ *
+ * @throw   std::invalid_argument if the processor does not
+ *          support the kernel
+ */
+BreadthFirstGenerator::BreadthFirstGenerator(double x1, double y1,
+   double x2, double y2, int level, const std::string& kernelName) :
+   firstPoint(x1, y1), lastPoint(x2, y2), curveLevel(level),
+   kernel(findKochKernel(kernelName)), kernelName(kernelName) {
+
+   if (kernel == nullptr) {
+      throw std::invalid_argument("Unsupported kernel " + kernelName);
+   }
+}
+
+/**
+ * Generates the whole Koch curve into the specified PointSink,
+ * starting with begin() and finishing with end(). The points are
+ * the same as those of KochGenerator::generate, within the
+ * tolerance documented in KochKernels.h.
+ *
+ * @pre            BreadthFirstGenerator must be initialized
+ *
+ * @post           state of this BreadthFirstGenerator does not
+ *                 change
+ *
+ * @param   sink   PointSink receiving the points of the curve
+ */
+void BreadthFirstGenerator::generate(PointSink& sink) const {
+   sink.begin(firstPoint, curveLevel);
+
+   int tileLevel = curveLevel < TILE_LEVEL ? curveLevel : TILE_LEVEL;
+   int topLevel = curveLevel - tileLevel;
+
+   // expand the top levels in full; each of their segments is a tile
+   std::vector<double> topXs(1, firstPoint.getXCoord());
+   std::vector<double> topYs(1, firstPoint.getYCoord());
+   topXs.push_back(lastPoint.getXCoord());
+   topYs.push_back(lastPoint.getYCoord());
+   std::vector<double> scratchXs;
+   std::vector<double> scratchYs;
+   expand(topXs, topYs, scratchXs, scratchYs, topLevel);
+
+   std::vector<double> tileXs;
+   std::vector<double> tileYs;
+   long long tileCount = (long long) topXs.size() - 1;
+
+   for (long long i = 0; i < tileCount; i++) {
+      tileXs.assign(topXs.begin() + i, topXs.begin() + i + 2);
+      tileYs.assign(topYs.begin() + i, topYs.begin() + i + 2);
+      expand(tileXs, tileYs, scratchXs, scratchYs, tileLevel);
+
+      // the first vertex of a tile is the last vertex of the previous
+      for (size_t j = 1; j < tileXs.size(); j++) {
+         sink.addPoint(Point(tileXs[j], tileYs[j]));
+      }
+   }
+
+   sink.end();
+}
+
+/**
+ * Retrieves the name of the kernel expanding the curve
+ *
+ * @pre     BreadthFirstGenerator must be initialized
+ *
+ * @post    state of this BreadthFirstGenerator does not change
+ *
+ * @return  name of the kernel
+ */
+std::string BreadthFirstGenerator::getKernelName() const {
+   return kernelName;
+}
+
+/**
+ * Expands the vertices in xs and ys by the specified number of
+ * levels, using otherXs and otherYs as scratch space
+ *
+ * @param   xs          X coordinates, replaced by the result
+ * @param   ys          Y coordinates, replaced by the result
+ * @param   otherXs     scratch X coordinates
+ * @param   otherYs     scratch Y coordinates
+ * @param   levels      number of levels to expand
+ */
+void BreadthFirstGenerator::expand(std::vector<double>& xs,
+   std::vector<double>& ys, std::vector<double>& otherXs,
+   std::vector<double>& otherYs, int levels) const {
+
+   for (int i = 0; i < levels; i++) {
+      long long segmentCount = (long long) xs.size() - 1;
+      otherXs.resize(4 * segmentCount + 1);
+      otherYs.resize(4 * segmentCount + 1);
+
+      kernel(xs.data(), ys.data(), segmentCount, otherXs.data(),
+         otherYs.data());
+
+      xs.swap(otherXs);
+      ys.swap(otherYs);
+   }
+} // end BreadthFirstGenerator.cpp
@@ -0,0 +1,106 @@
+/**
+ * BreadthFirstGenerator.h
+ *
+ * Declarations for the BreadthFirstGenerator class, which generates
+ * a Koch curve level by level instead of recursively. The vertices
+ * of a level are kept in structure-of-arrays form and every segment
+ * is expanded into four by a SIMD kernel from KochKernels.h. High
+ * levels are expanded in tiles so that memory stays bounded.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <string>
+#include <vector>
+#include "KochKernels.h"
+#include "Point.h"
+#include "PointSink.h"
+
+/**
+ * Represents a breadth-first, vectorized generator of a Koch curve
+ */
+class BreadthFirstGenerator {
+public:
+   /**
+    * Constructor for BreadthFirstGenerator class, which uses the
+    * fastest kernel the processor supports
+    *
+    * @param   x1    X coordinate of first point
+    * @param   y1    Y coordinate of first point
+    * @param   x2    X coordinate of second point
+    * @param   y2    Y coordinate of second point
+    * @param   level Koch level to draw
+    */
+   BreadthFirstGenerator(double x1, double y1, double x2, double y2,
+      int level);
+
+   /**
+    * Constructor for BreadthFirstGenerator class, which uses the
+    * specified kernel
+    *
+    * @param   x1          X coordinate of first point
+    * @param   y1          Y coordinate of first point
+    * @param   x2          X coordinate of second point
+    * @param   y2          Y coordinate of second point
+    * @param   level       Koch level to draw
+    * @param   kernelName  "scalar", "sse2" or "avx2"
+    *
+    * @throw   std::invalid_argument if the processor does not
+    *          support the kernel
+    */
+   BreadthFirstGenerator(double x1, double y1, double x2, double y2,
+      int level, const std::string& kernelName);
+
+   /**
+    * Generates the whole Koch curve into the specified PointSink,
+    * starting with begin() and finishing with end(). The points are
+    * the same as those of KochGenerator::generate, within the
+    * tolerance documented in KochKernels.h.
+    *
+    * @pre            BreadthFirstGenerator must be initialized
+    *
+    * @post           state of this BreadthFirstGenerator does not
+    *                 change
+    *
+    * @param   sink   PointSink receiving the points of the curve
+    */
+   void generate(PointSink& sink) const;
+
+   /**
+    * Retrieves the name of the kernel expanding the curve
+    *
+    * @pre     BreadthFirstGenerator must be initialized
+    *
+    * @post    state of this BreadthFirstGenerator does not change
+    *
+    * @return  name of the kernel
+    */
+   std::string getKernelName() const;
+
+private:
+   /**
+    * Expands the vertices in xs and ys by the specified number of
+    * levels, using otherXs and otherYs as scratch space
+    *
+    * @param   xs          X coordinates, replaced by the result
+    * @param   ys          Y coordinates, replaced by the result
+    * @param   otherXs     scratch X coordinates
+    * @param   otherYs     scratch Y coordinates
+    * @param   levels      number of levels to expand
+    */
+   void expand(std::vector<double>& xs, std::vector<double>& ys,
+      std::vector<double>& otherXs, std::vector<double>& otherYs,
+      int levels) const;
+
+   /** first point of the curve */
+   Point firstPoint;
+   /** last point of the curve */
+   Point lastPoint;
+   /** Koch curve level */
+   int curveLevel;
+   /** kernel expanding one level */
+   KochKernel kernel;
+   /** name of the kernel */
+   std::string kernelName;
+}; // end BreadthFirstGenerator.h
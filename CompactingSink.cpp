@@ -0,0 +1,144 @@
+/**
+ * CompactingSink.cpp
+ *
+ * Implementations for the CompactingSink class, a PointSink that 
+ * snaps a curve to integer positions, drops zero-length moves and
+ * merges runs of moves in the same direction.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include "CompactingSink.h"
+
+/**
+ * Constructor for CompactingSink class
+ *
+ * @param   sink     PointSink receiving the compacted curve
+ */
+CompactingSink::CompactingSink(PointSink& sink) :
+   sink(sink), hasPending(false), sentXCoord(0), sentYCoord(0),
+   pendingXCoord(0), pendingYCoord(0), receivedCount(0), sentCount(0) {}
+
+/**
+ * Hands the first point, snapped to an integer position, to the
+ * receiving PointSink
+ *
+ * @pre                 no Points have been added to this sink
+ *
+ * @post                receiving PointSink has begun the curve
+ *
+ * @param   firstPoint  first point of the Koch curve
+ * @param   level       Koch level of the curve
+ */
+void CompactingSink::begin(const Point& firstPoint, int level) {
+   sentXCoord = std::llround(firstPoint.getXCoord());
+   sentYCoord = std::llround(firstPoint.getYCoord());
+   hasPending = false;
+   receivedCount = 0;
+   sentCount = 0;
+
+   sink.begin(Point((double) sentXCoord, (double) sentYCoord), level);
+}
+
+/**
+ * Receives the next Point of the Koch curve. The Point is held
+ * back until it is known whether the next move continues in the
+ * same direction.
+ *
+ * @pre              begin() has been called
+ *
+ * @post             earlier Points may be handed on
+ *
+ * @param   point    next Point of the Koch curve
+ */
+void CompactingSink::addPoint(const Point& point) {
+   // snapping the absolute position keeps every delta exact
+   long long xCoord = std::llround(point.getXCoord());
+   long long yCoord = std::llround(point.getYCoord());
+   receivedCount++;
+
+   long long lastXCoord = hasPending ? pendingXCoord : sentXCoord;
+   long long lastYCoord = hasPending ? pendingYCoord : sentYCoord;
+   if (xCoord == lastXCoord && yCoord == lastYCoord) {
+      return;
+   }
+
+   if (hasPending) {
+      long long priorXDelta = pendingXCoord - sentXCoord;
+      long long priorYDelta = pendingYCoord - sentYCoord;
+      long long xDelta = xCoord - pendingXCoord;
+      long long yDelta = yCoord - pendingYCoord;
+
+      // a move in the same direction extends the held back move; a
+      // move back over it is kept, so what is drawn does not change
+      bool sameDirection = priorXDelta * yDelta == priorYDelta * xDelta &&
+         priorXDelta * xDelta + priorYDelta * yDelta > 0;
+      if (!sameDirection) {
+         sendPending();
+      }
+   }
+
+   hasPending = true;
+   pendingXCoord = xCoord;
+   pendingYCoord = yCoord;
+}
+
+/**
+ * Hands the held back Point on and closes the path of the 
+ * receiving PointSink
+ *
+ * @pre     begin() has been called
+ *
+ * @post    receiving PointSink has closed the path
+ */
+void CompactingSink::closePath() {
+   if (hasPending) {
+      sendPending();
+   }
+   sink.closePath();
+}
+
+/**
+ * Hands the held back Point to the receiving PointSink and ends
+ * the curve
+ *
+ * @pre     begin() has been called
+ *
+ * @post    receiving PointSink has ended the curve
+ */
+void CompactingSink::end() {
+   if (hasPending) {
+      sendPending();
+   }
+   sink.end();
+}
+
+/**
+ * Retrieves the number of Points received after the first
+ *
+ * @return  number of Points received
+ */
+long long CompactingSink::getReceivedCount() const {
+   return receivedCount;
+}
+
+/**
+ * Retrieves the number of Points handed on after the first
+ *
+ * @return  number of Points handed on
+ */
+long long CompactingSink::getSentCount() const {
+   return sentCount;
+}
+
+/**
+ * Hands the held back position to the receiving PointSink
+ */
+void CompactingSink::sendPending() {
+   sink.addPoint(Point((double) pendingXCoord, (double) pendingYCoord));
+   sentXCoord = pendingXCoord;
+   sentYCoord = pendingYCoord;
+   sentCount++;
+   hasPending = false;
+} // end CompactingSink.cpp
@@ -0,0 +1,114 @@
+/**
+ * CompactingSink.h
+ *
+ * Declarations for the CompactingSink class, a PointSink that sits
+ * in front of a writer and removes what cannot be seen at the
+ * writer's integer output resolution. Points are snapped to the
+ * nearest integer position, so every delta is exact and rounding
+ * error never accumulates; moves that stay on the same integer 
+ * position are dropped, and runs of moves in the same direction 
+ * are merged into one.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include "PointSink.h"
+#include "Point.h"
+
+/**
+ * Represents a PointSink that hands a compacted curve to another
+ * PointSink
+ */
+class CompactingSink : public PointSink {
+public:
+   /**
+    * Constructor for CompactingSink class
+    *
+    * @param   sink     PointSink receiving the compacted curve
+    */
+   explicit CompactingSink(PointSink& sink);
+
+   /**
+    * Hands the first point, snapped to an integer position, to the
+    * receiving PointSink
+    *
+    * @pre                 no Points have been added to this sink
+    *
+    * @post                receiving PointSink has begun the curve
+    *
+    * @param   firstPoint  first point of the Koch curve
+    * @param   level       Koch level of the curve
+    */
+   void begin(const Point& firstPoint, int level);
+
+   /**
+    * Receives the next Point of the Koch curve. The Point is held
+    * back until it is known whether the next move continues in the
+    * same direction.
+    *
+    * @pre              begin() has been called
+    *
+    * @post             earlier Points may be handed on
+    *
+    * @param   point    next Point of the Koch curve
+    */
+   void addPoint(const Point& point);
+
+   /**
+    * Hands the held back Point on and closes the path of the 
+    * receiving PointSink
+    *
+    * @pre     begin() has been called
+    *
+    * @post    receiving PointSink has closed the path
+    */
+   void closePath();
+
+   /**
+    * Hands the held back Point to the receiving PointSink and ends
+    * the curve
+    *
+    * @pre     begin() has been called
+    *
+    * @post    receiving PointSink has ended the curve
+    */
+   void end();
+
+   /**
+    * Retrieves the number of Points received after the first
+    *
+    * @return  number of Points received
+    */
+   long long getReceivedCount() const;
+
+   /**
+    * Retrieves the number of Points handed on after the first
+    *
+    * @return  number of Points handed on
+    */
+   long long getSentCount() const;
+
+private:
+   /**
+    * Hands the held back position to the receiving PointSink
+    */
+   void sendPending();
+
+   /** PointSink receiving the compacted curve */
+   PointSink& sink;
+   /** true if a position is held back */
+   bool hasPending;
+   /** X coordinate of the last position handed on */
+   long long sentXCoord;
+   /** Y coordinate of the last position handed on */
+   long long sentYCoord;
+   /** X coordinate of the held back position */
+   long long pendingXCoord;
+   /** Y coordinate of the held back position */
+   long long pendingYCoord;
+   /** number of Points received after the first */
+   long long receivedCount;
+   /** number of Points handed on after the first */
+   long long sentCount;
+}; // end CompactingSink.h
@@ -0,0 +1,50 @@
+/**
+ * Crc32.cpp
+ *
+ * Implementations for the CRC-32 checksum, computed byte by byte 
+ * from a lookup table.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <vector>
+#include "Crc32.h"
+
+namespace {
+   /**
+    * Builds the lookup table of the byte-wise CRC-32
+    */
+   std::vector<std::uint32_t> makeCrcTable() {
+      std::vector<std::uint32_t> table(256);
+
+      for (std::uint32_t n = 0; n < 256; n++) {
+         std::uint32_t crc = n;
+         for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 1 ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+         }
+         table[n] = crc;
+      }
+      return table;
+   }
+}
+
+/**
+ * Updates a CRC-32 checksum
+ *
+ * @param   crc       checksum of the prior bytes, 0 to start
+ * @param   data      bytes to add to the checksum
+ * @param   size      number of bytes
+ *
+ * @return            checksum including the bytes
+ */
+std::uint32_t updateCrc32(std::uint32_t crc, const unsigned char* data,
+   std::size_t size) {
+
+   static const std::vector<std::uint32_t> table = makeCrcTable();
+
+   crc = ~crc;
+   for (std::size_t i = 0; i < size; i++) {
+      crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+   }
+   return ~crc;
+} // end Crc32.cpp
@@ -0,0 +1,26 @@
+/**
+ * Crc32.h
+ *
+ * Declarations for the CRC-32 checksum (polynomial 0xedb88320, as 
+ * used by PNG, zlib and gzip), shared by the PNG encoder and the 
+ * template files.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Updates a CRC-32 checksum
+ *
+ * @param   crc       checksum of the prior bytes, 0 to start
+ * @param   data      bytes to add to the checksum
+ * @param   size      number of bytes
+ *
+ * @return            checksum including the bytes
+ */
+std::uint32_t updateCrc32(std::uint32_t crc, const unsigned char* data,
+   std::size_t size);
+// end Crc32.h
@@ -0,0 +1,620 @@
+/**
+ * CurveServer.cpp
+ *
+ * Implementations for the CurveServer class, which draws Koch curves
+ * for local clients, and for requestCurve, its client.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "CurveServer.h"
+#include "CurveWriter.h"
+#include "KochGenerator.h"
+
+namespace {
+   /** largest request accepted, in bytes */
+   const std::uint32_t MAX_REQUEST_SIZE = 4096;
+   /** largest chunk of a response, in bytes */
+   const std::size_t CHUNK_SIZE = 1 << 16;
+   /** status byte of a response holding a curve */
+   const char STATUS_OK = 'O';
+   /** status byte of a response holding an error message */
+   const char STATUS_ERROR = 'E';
+
+   /**
+    * Removes a socket left at a path by an earlier server, so that a 
+    * new server can bind to it. Any other kind of file is kept.
+    *
+    * @param   path   path of the Unix socket
+    *
+    * @throw   std::runtime_error if the path holds a file that is not
+    *          a socket, or the socket cannot be removed
+    */
+   void removeStaleSocket(const std::string& path) {
+      struct stat status;
+      if (lstat(path.c_str(), &status) != 0) {
+         if (errno == ENOENT) {
+            return;
+         }
+         throw std::runtime_error("Cannot inspect " + path + ": " +
+            std::strerror(errno));
+      }
+      if (!S_ISSOCK(status.st_mode)) {
+         throw std::runtime_error("Not replacing " + path + 
+            ", which is not a socket");
+      }
+      if (unlink(path.c_str()) != 0) {
+         throw std::runtime_error("Cannot remove " + path + ": " +
+            std::strerror(errno));
+      }
+   }
+
+   /**
+    * Opens a socket for the specified address, either listening on it
+    * or connected to it
+    *
+    * @param   address      unix:<path> or tcp:<port>
+    * @param   listening    true to listen, false to connect
+    * @param   socketPath   receives the path of a Unix socket, or
+    *                       empty for TCP
+    *
+    * @return               the socket
+    *
+    * @throw   std::invalid_argument if the address is malformed
+    * @throw   std::runtime_error if the socket cannot be opened, or a
+    *          listening Unix socket path holds another kind of file
+    */
+   int openSocket(const std::string& address, bool listening,
+      std::string& socketPath) {
+
+      sockaddr_storage storage;
+      socklen_t length;
+      std::memset(&storage, 0, sizeof(storage));
+      socketPath.clear();
+
+      if (address.compare(0, 5, "unix:") == 0) {
+         sockaddr_un* unixAddress = (sockaddr_un*) &storage;
+         std::string path = address.substr(5);
+         if (path.empty() || path.size() >= sizeof(unixAddress->sun_path)) {
+            throw std::invalid_argument("Invalid socket path " + path);
+         }
+
+         unixAddress->sun_family = AF_UNIX;
+         std::memcpy(unixAddress->sun_path, path.c_str(), path.size());
+         length = sizeof(sockaddr_un);
+         socketPath = path;
+      }
+      else if (address.compare(0, 4, "tcp:") == 0) {
+         char* end;
+         long port = std::strtol(address.c_str() + 4, &end, 10);
+         if (address.size() == 4 || *end != '\0' || port < 0 ||
+            port > 65535) {
+            throw std::invalid_argument("Invalid port in " + address);
+         }
+
+         // only local clients are served
+         sockaddr_in* inetAddress = (sockaddr_in*) &storage;
+         inetAddress->sin_family = AF_INET;
+         inetAddress->sin_port = htons((std::uint16_t) port);
+         inetAddress->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+         length = sizeof(sockaddr_in);
+      }
+      else {
+         throw std::invalid_argument("Address must be unix:<path> or "
+            "tcp:<port>");
+      }
+
+      int opened = socket(storage.ss_family, SOCK_STREAM, 0);
+      if (opened < 0) {
+         throw std::runtime_error("Cannot open socket for " + address);
+      }
+
+      bool ready;
+      if (listening) {
+         int reuse = 1;
+         setsockopt(opened, SOL_SOCKET, SO_REUSEADDR, &reuse,
+            sizeof(reuse));
+         if (!socketPath.empty()) {
+            removeStaleSocket(socketPath);
+         }
+         ready = bind(opened, (sockaddr*) &storage, length) == 0 &&
+            listen(opened, SOMAXCONN) == 0;
+      }
+      else {
+         ready = connect(opened, (sockaddr*) &storage, length) == 0;
+      }
+
+      if (!ready) {
+         close(opened);
+         throw std::runtime_error(std::string(listening ?
+            "Cannot listen on " : "Cannot connect to ") + address +
+            ": " + std::strerror(errno));
+      }
+      return opened;
+   }
+
+   /**
+    * Sends all bytes, retrying partial sends
+    *
+    * @return      false if the connection failed
+    */
+   bool sendAll(int connection, const char* data, std::size_t size) {
+      while (size > 0) {
+         ssize_t sent = send(connection, data, size, MSG_NOSIGNAL);
+         if (sent < 0 && errno == EINTR) {
+            continue;
+         }
+         if (sent <= 0) {
+            return false;
+         }
+         data += sent;
+         size -= sent;
+      }
+      return true;
+   }
+
+   /**
+    * Receives exactly the specified number of bytes
+    *
+    * @return      false if the connection closed or failed first
+    */
+   bool receiveAll(int connection, char* data, std::size_t size) {
+      while (size > 0) {
+         ssize_t received = recv(connection, data, size, 0);
+         if (received < 0 && errno == EINTR) {
+            continue;
+         }
+         if (received <= 0) {
+            return false;
+         }
+         data += received;
+         size -= received;
+      }
+      return true;
+   }
+
+   /**
+    * Sends a little-endian uint32
+    *
+    * @return      false if the connection failed
+    */
+   bool sendUint32(int connection, std::uint32_t value) {
+      char bytes[4];
+      for (int i = 0; i < 4; i++) {
+         bytes[i] = (char) (value >> (8 * i));
+      }
+      return sendAll(connection, bytes, 4);
+   }
+
+   /**
+    * Receives a little-endian uint32
+    *
+    * @return      false if the connection closed or failed first
+    */
+   bool receiveUint32(int connection, std::uint32_t& value) {
+      unsigned char bytes[4];
+      if (!receiveAll(connection, (char*) bytes, 4)) {
+         return false;
+      }
+      value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+         ((std::uint32_t) bytes[3] << 24);
+      return true;
+   }
+
+   /**
+    * Sends a whole response: the status byte, the body in chunks and
+    * the empty chunk that ends it
+    *
+    * @return      false if the connection failed
+    */
+   bool sendResponse(int connection, char status, const std::string& body) {
+      if (!sendAll(connection, &status, 1)) {
+         return false;
+      }
+      for (std::size_t first = 0; first < body.size();
+         first += CHUNK_SIZE) {
+         std::size_t size = std::min(CHUNK_SIZE, body.size() - first);
+         if (!sendUint32(connection, size) ||
+            !sendAll(connection, body.data() + first, size)) {
+            return false;
+         }
+      }
+      return sendUint32(connection, 0);
+   }
+
+   /**
+    * Stream buffer that sends everything written to it as response
+    * chunks and keeps a copy of it while it stays within a limit
+    */
+   class ChunkBuffer : public std::streambuf {
+   public:
+      ChunkBuffer(int connection, std::size_t captureLimit) :
+         buffer(CHUNK_SIZE), connection(connection),
+         captureLimit(captureLimit), capturing(true), failed(false) {
+         setp(buffer.data(), buffer.data() + buffer.size());
+      }
+
+      /**
+       * Sends the remaining bytes and the empty chunk
+       *
+       * @return   false if the connection failed
+       */
+      bool finish() {
+         return sendChunk() && sendUint32(connection, 0) && !failed;
+      }
+
+      /**
+       * Retrieves the copy of the whole body
+       *
+       * @return   the body, or nullptr if it grew beyond the limit
+       */
+      std::string* getCapture() {
+         return capturing ? &capture : nullptr;
+      }
+
+   protected:
+      int overflow(int character) {
+         if (!sendChunk()) {
+            return traits_type::eof();
+         }
+         if (character != traits_type::eof()) {
+            *pptr() = (char) character;
+            pbump(1);
+         }
+         return traits_type::not_eof(character);
+      }
+
+      int sync() {
+         return sendChunk() ? 0 : -1;
+      }
+
+   private:
+      /**
+       * Sends the buffered bytes as one chunk
+       *
+       * @return   false if the connection failed
+       */
+      bool sendChunk() {
+         std::size_t size = pptr() - pbase();
+         if (failed || size == 0) {
+            return !failed;
+         }
+
+         if (capturing && capture.size() + size <= captureLimit) {
+            capture.append(pbase(), size);
+         }
+         else {
+            capturing = false;
+            std::string().swap(capture);
+         }
+
+         failed = !sendUint32(connection, size) ||
+            !sendAll(connection, pbase(), size);
+         setp(buffer.data(), buffer.data() + buffer.size());
+         return !failed;
+      }
+
+      /** bytes not yet sent */
+      std::vector<char> buffer;
+      /** socket of the connection */
+      int connection;
+      /** largest body copied */
+      std::size_t captureLimit;
+      /** true while the whole body is copied */
+      bool capturing;
+      /** true once sending failed */
+      bool failed;
+      /** copy of the body sent so far */
+      std::string capture;
+   };
+}
+
+/**
+ * Constructor for CurveServer class, which starts listening on
+ * the specified address. A socket left at a Unix socket path is
+ * replaced; any other file there is kept and reported.
+ *
+ * @param   address        unix:<path>, or tcp:<port> on localhost
+ *                         where port 0 picks a free port
+ * @param   threadCount    number of connections served at a time
+ * @param   cacheCapacity  size of the LruCache of curves in bytes
+ * @param   templates      cache drawing every curve, or nullptr to
+ *                         draw them recursively
+ *
+ * @throw   std::invalid_argument if the address is malformed
+ * @throw   std::runtime_error if the address cannot be listened on,
+ *          or a Unix socket path holds a file that is not a socket
+ */
+CurveServer::CurveServer(const std::string& address, int threadCount,
+   std::size_t cacheCapacity, TemplateCache* templates) :
+   address(address), listener(openSocket(address, true, socketPath)),
+   stopping(false), results(cacheCapacity), templates(templates),
+   hitCount(0), missCount(0), pool(threadCount) {
+
+   // report the port the system picked
+   if (socketPath.empty()) {
+      sockaddr_in bound;
+      socklen_t length = sizeof(bound);
+      getsockname(listener, (sockaddr*) &bound, &length);
+      this->address = "tcp:" + std::to_string(ntohs(bound.sin_port));
+   }
+}
+
+/**
+ * Destructor for CurveServer class, which stops the server, waits
+ * for open connections and removes a Unix socket path
+ */
+CurveServer::~CurveServer() {
+   stop();
+   pool.wait();
+   close(listener);
+
+   if (!socketPath.empty()) {
+      unlink(socketPath.c_str());
+   }
+}
+
+/**
+ * Retrieves the address the server listens on, with the port
+ * chosen for tcp:0
+ *
+ * @return  address of the server
+ */
+std::string CurveServer::getAddress() const {
+   return address;
+}
+
+/**
+ * Accepts connections and serves their requests on the pool until
+ * stop() is called
+ *
+ * @pre     serve() is not already running
+ *
+ * @post    no further connections are accepted
+ */
+void CurveServer::serve() {
+   while (!stopping) {
+      int connection = accept(listener, nullptr, nullptr);
+      if (connection < 0) {
+         if (errno == EINTR || errno == ECONNABORTED) {
+            continue;
+         }
+         if (stopping) {
+            break;
+         }
+         throw std::runtime_error(std::string("Cannot accept: ") +
+            std::strerror(errno));
+      }
+
+      {
+         std::lock_guard<std::mutex> guard(connectionsLock);
+         if (stopping) {
+            close(connection);
+            break;
+         }
+         connections.insert(connection);
+      }
+      pool.submit([this, connection] { serveConnection(connection); });
+   }
+}
+
+/**
+ * Makes serve() return and closes open connections. May be called
+ * from any thread.
+ *
+ * @post    server accepts no further requests
+ */
+void CurveServer::stop() {
+   if (stopping.exchange(true)) {
+      return;
+   }
+
+   // wake a blocked accept(), which a shutdown alone does not do for
+   // every kind of socket
+   shutdown(listener, SHUT_RDWR);
+   try {
+      std::string ignored;
+      close(openSocket(address, false, ignored));
+   }
+   catch (const std::exception&) {}
+
+   std::lock_guard<std::mutex> guard(connectionsLock);
+   for (int connection : connections) {
+      shutdown(connection, SHUT_RDWR);
+   }
+}
+
+/**
+ * Retrieves the number of requests answered from the LruCache
+ *
+ * @return  number of cache hits
+ */
+std::uint64_t CurveServer::getHitCount() const {
+   return hitCount;
+}
+
+/**
+ * Retrieves the number of requests whose curve was generated
+ *
+ * @return  number of cache misses
+ */
+std::uint64_t CurveServer::getMissCount() const {
+   return missCount;
+}
+
+/**
+ * Serves the requests of one connection until it is closed
+ *
+ * @param   connection   socket of the connection
+ */
+void CurveServer::serveConnection(int connection) {
+   std::uint32_t size;
+
+   while (!stopping && receiveUint32(connection, size)) {
+      if (size > MAX_REQUEST_SIZE) {
+         sendResponse(connection, STATUS_ERROR, "Request is too long");
+         break;
+      }
+
+      std::string request(size, '\0');
+      if (!receiveAll(connection, &request[0], size) ||
+         !answer(connection, request)) {
+         break;
+      }
+   }
+
+   std::lock_guard<std::mutex> guard(connectionsLock);
+   connections.erase(connection);
+   close(connection);
+}
+
+/**
+ * Answers one request on a connection
+ *
+ * @param   connection   socket of the connection
+ * @param   request      text of the request
+ *
+ * @return               false if the connection failed
+ */
+bool CurveServer::answer(int connection, const std::string& request) {
+   std::istringstream fields(request);
+   double x1, y1, x2, y2;
+   int level;
+   std::string format = "ps";
+   std::string extra;
+
+   if (!(fields >> x1 >> y1 >> x2 >> y2 >> level)) {
+      return sendResponse(connection, STATUS_ERROR,
+         "Request must be x1 y1 x2 y2 level [format]");
+   }
+   if (fields >> format && fields >> extra) {
+      return sendResponse(connection, STATUS_ERROR,
+         "Unexpected field " + extra);
+   }
+   if (level < 0 || level > MAX_REQUEST_LEVEL) {
+      return sendResponse(connection, STATUS_ERROR,
+         "Koch curve level must be between 0 and " +
+         std::to_string(MAX_REQUEST_LEVEL));
+   }
+
+   // equal requests share a key however their numbers were written
+   std::ostringstream key;
+   key << std::hexfloat << x1 << ' ' << y1 << ' ' << x2 << ' ' << y2 <<
+      ' ' << level << ' ' << format;
+
+   std::shared_ptr<const std::string> cached = results.find(key.str());
+   if (cached) {
+      hitCount++;
+      return sendResponse(connection, STATUS_OK, *cached);
+   }
+   missCount++;
+
+   Point start(x1, y1);
+   Point end(x2, y2);
+   ChunkBuffer buffer(connection, results.getCapacity());
+   std::ostream output(&buffer);
+   std::unique_ptr<PointSink> writer;
+
+   try {
+      writer = createWriter(format, output, end,
+         (1ULL << (2 * level)) + 1, false);
+   }
+   catch (const std::invalid_argument& error) {
+      return sendResponse(connection, STATUS_ERROR, error.what());
+   }
+
+   if (!sendAll(connection, &STATUS_OK, 1)) {
+      return false;
+   }
+
+   if (templates != nullptr) {
+      writer->begin(start, level);
+      templates->drawKoch(start, end, level, *writer);
+      writer->end();
+   }
+   else {
+      KochGenerator generator(x1, y1, x2, y2, level, KochOptions::streamed());
+      generator.generate(*writer);
+   }
+   writer.reset();
+
+   if (!buffer.finish()) {
+      return false;
+   }
+
+   std::string* capture = buffer.getCapture();
+   if (capture != nullptr) {
+      results.insert(key.str(),
+         std::make_shared<const std::string>(std::move(*capture)));
+   }
+   return true;
+}
+
+/**
+ * Requests a curve from a CurveServer and writes it to the specified
+ * output stream as it arrives
+ *
+ * @param   address    address of the server
+ * @param   request    text of the request, x1 y1 x2 y2 level [format]
+ * @param   output     output stream receiving the curve
+ *
+ * @throw   std::runtime_error if the server cannot be reached, the
+ *          connection fails or the server reports an error
+ */
+void requestCurve(const std::string& address, const std::string& request,
+   std::ostream& output) {
+
+   std::string socketPath;
+   int connection = openSocket(address, false, socketPath);
+   std::vector<char> chunk;
+   std::string message;
+   char status = 0;
+   bool complete = false;
+
+   if (sendUint32(connection, request.size()) &&
+      sendAll(connection, request.data(), request.size()) &&
+      receiveAll(connection, &status, 1)) {
+
+      std::uint32_t size;
+      while (receiveUint32(connection, size)) {
+         if (size == 0) {
+            complete = true;
+            break;
+         }
+
+         chunk.resize(size);
+         if (!receiveAll(connection, chunk.data(), size)) {
+            break;
+         }
+         if (status == STATUS_OK) {
+            output.write(chunk.data(), size);
+         }
+         else {
+            message.append(chunk.data(), size);
+         }
+      }
+   }
+   close(connection);
+
+   if (!complete) {
+      throw std::runtime_error("Connection to " + address + " failed");
+   }
+   if (status != STATUS_OK) {
+      throw std::runtime_error(message);
+   }
+   output.flush();
+} // end CurveServer.cpp
@@ -0,0 +1,169 @@
+/**
+ * CurveServer.h
+ *
+ * Declarations for the CurveServer class, a resident process that
+ * draws Koch curves for clients over a Unix domain socket or a
+ * localhost TCP port, and for requestCurve, its client. Addresses
+ * are written unix:<path> or tcp:<port>.
+ *
+ * A connection carries any number of requests, one after another.
+ * A request is a frame of a little-endian uint32 length followed by
+ * that many bytes of text
+ *
+ *    x1 y1 x2 y2 level [format]
+ *
+ * where format is one of the createWriter formats, ps by default.
+ * The response is a status byte, 'O' for a curve or 'E' for an
+ * error message, followed by the curve or message as chunks of a
+ * uint32 length and that many bytes, ending with an empty chunk.
+ * Curves are streamed as they are generated; recent curves are kept
+ * in an LruCache and sent again without being generated.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include "LruCache.h"
+#include "TemplateCache.h"
+#include "ThreadPool.h"
+
+/**
+ * Represents a server drawing Koch curves for local clients
+ */
+class CurveServer {
+public:
+   /** highest level a request may draw */
+   static const int MAX_REQUEST_LEVEL = 12;
+
+   /**
+    * Constructor for CurveServer class, which starts listening on
+    * the specified address. A socket left at a Unix socket path is
+    * replaced; any other file there is kept and reported.
+    *
+    * @param   address        unix:<path>, or tcp:<port> on localhost
+    *                         where port 0 picks a free port
+    * @param   threadCount    number of connections served at a time
+    * @param   cacheCapacity  size of the LruCache of curves in bytes
+    * @param   templates      cache drawing every curve, or nullptr to
+    *                         draw them recursively
+    *
+    * @throw   std::invalid_argument if the address is malformed
+    * @throw   std::runtime_error if the address cannot be listened on,
+    *          or a Unix socket path holds a file that is not a socket
+    */
+   CurveServer(const std::string& address, int threadCount,
+      std::size_t cacheCapacity, TemplateCache* templates);
+
+   /**
+    * Destructor for CurveServer class, which stops the server, waits
+    * for open connections and removes a Unix socket path
+    */
+   ~CurveServer();
+
+   CurveServer(const CurveServer&) = delete;
+   CurveServer& operator=(const CurveServer&) = delete;
+
+   /**
+    * Retrieves the address the server listens on, with the port
+    * chosen for tcp:0
+    *
+    * @return  address of the server
+    */
+   std::string getAddress() const;
+
+   /**
+    * Accepts connections and serves their requests on the pool until
+    * stop() is called
+    *
+    * @pre     serve() is not already running
+    *
+    * @post    no further connections are accepted
+    */
+   void serve();
+
+   /**
+    * Makes serve() return and closes open connections. May be called
+    * from any thread.
+    *
+    * @post    server accepts no further requests
+    */
+   void stop();
+
+   /**
+    * Retrieves the number of requests answered from the LruCache
+    *
+    * @return  number of cache hits
+    */
+   std::uint64_t getHitCount() const;
+
+   /**
+    * Retrieves the number of requests whose curve was generated
+    *
+    * @return  number of cache misses
+    */
+   std::uint64_t getMissCount() const;
+
+private:
+   /**
+    * Serves the requests of one connection until it is closed
+    *
+    * @param   connection   socket of the connection
+    */
+   void serveConnection(int connection);
+
+   /**
+    * Answers one request on a connection
+    *
+    * @param   connection   socket of the connection
+    * @param   request      text of the request
+    *
+    * @return               false if the connection failed
+    */
+   bool answer(int connection, const std::string& request);
+
+   /** address the server listens on */
+   std::string address;
+   /** path of the Unix socket, or empty for TCP */
+   std::string socketPath;
+   /** listening socket */
+   int listener;
+   /** true once stop() has been called */
+   std::atomic<bool> stopping;
+   /** sockets of open connections */
+   std::set<int> connections;
+   /** guards connections */
+   std::mutex connectionsLock;
+   /** recently produced curves by request */
+   LruCache results;
+   /** cache drawing every curve, or nullptr */
+   TemplateCache* templates;
+   /** number of requests answered from results */
+   std::atomic<std::uint64_t> hitCount;
+   /** number of requests whose curve was generated */
+   std::atomic<std::uint64_t> missCount;
+   /** pool serving connections; declared last so that it is
+       destroyed, waiting for connections, before everything else */
+   ThreadPool pool;
+};
+
+/**
+ * Requests a curve from a CurveServer and writes it to the specified
+ * output stream as it arrives
+ *
+ * @param   address    address of the server
+ * @param   request    text of the request, x1 y1 x2 y2 level [format]
+ * @param   output     output stream receiving the curve
+ *
+ * @throw   std::runtime_error if the server cannot be reached, the
+ *          connection fails or the server reports an error
+ */
+void requestCurve(const std::string& address, const std::string& request,
+   std::ostream& output);
+// end CurveServer.h
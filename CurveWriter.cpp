@@ -0,0 +1,73 @@
+/**
+ * CurveWriter.cpp
+ *
+ * Implementations for creating the PointSink that writes a curve in
+ * one of the supported output formats.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <stdexcept>
+#include "BinaryCurve.h"
+#include "CurveWriter.h"
+#include "PdfWriter.h"
+#include "PostScriptWriter.h"
+#include "SvgWriter.h"
+
+/**
+ * Creates the writer for the specified output format. Of the binary
+ * formats, binary and binary64 convert back to the PostScript of the
+ * curve exactly; binary32 rounds coordinates to floats and may not.
+ *
+ * @param   format      "ps", "svg", "pdf", "binary", "binary32" or
+ *                      "binary64"
+ * @param   output      output stream to write the curve to
+ * @param   lastPoint   last point of the curve
+ * @param   pointCount  number of points in the curve, or 
+ *                      UNKNOWN_POINT_COUNT
+ * @param   closed      true if the path will be closed
+ *
+ * @return              writer for the format
+ *
+ * @throw   std::invalid_argument if the format is unknown
+ */
+std::unique_ptr<PointSink> createWriter(const std::string& format,
+   std::ostream& output, const Point& lastPoint, 
+   std::uint64_t pointCount, bool closed) {
+
+   if (format == "ps") {
+      return std::unique_ptr<PointSink>(new PostScriptWriter(output));
+   }
+   if (format == "svg") {
+      return std::unique_ptr<PointSink>(new SvgWriter(output));
+   }
+   if (format == "pdf") {
+      return std::unique_ptr<PointSink>(new PdfWriter(output));
+   }
+   if (format == "binary") {
+      return std::unique_ptr<PointSink>(new BinaryCurveWriter(output,
+         DELTA_VARINT, lastPoint, pointCount, closed));
+   }
+   if (format == "binary32") {
+      return std::unique_ptr<PointSink>(new BinaryCurveWriter(output,
+         FLOAT32, lastPoint, pointCount, closed));
+   }
+   if (format == "binary64") {
+      return std::unique_ptr<PointSink>(new BinaryCurveWriter(output,
+         FLOAT64, lastPoint, pointCount, closed));
+   }
+   throw std::invalid_argument("Unknown format " + format);
+}
+
+/**
+ * Determines whether createWriter accepts a format
+ *
+ * @param   format   name of the format
+ *
+ * @return           true if the format is "ps", "svg", "pdf", "binary",
+ *                   "binary32" or "binary64"
+ */
+bool isWriterFormat(const std::string& format) {
+   return format == "ps" || format == "svg" || format == "pdf" ||
+      format == "binary" || format == "binary32" || format == "binary64";
+} // end CurveWriter.cpp
@@ -0,0 +1,49 @@
+/**
+ * CurveWriter.h
+ *
+ * Declarations for creating the PointSink that writes a curve in one
+ * of the supported output formats, shared by single curves and batch
+ * jobs.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "Point.h"
+#include "PointSink.h"
+
+/**
+ * Creates the writer for the specified output format. Of the binary
+ * formats, binary and binary64 convert back to the PostScript of the
+ * curve exactly; binary32 rounds coordinates to floats and may not.
+ *
+ * @param   format      "ps", "svg", "pdf", "binary", "binary32" or
+ *                      "binary64"
+ * @param   output      output stream to write the curve to
+ * @param   lastPoint   last point of the curve
+ * @param   pointCount  number of points in the curve, or 
+ *                      UNKNOWN_POINT_COUNT
+ * @param   closed      true if the path will be closed
+ *
+ * @return              writer for the format
+ *
+ * @throw   std::invalid_argument if the format is unknown
+ */
+std::unique_ptr<PointSink> createWriter(const std::string& format,
+   std::ostream& output, const Point& lastPoint, 
+   std::uint64_t pointCount, bool closed);
+
+/**
+ * Determines whether createWriter accepts a format
+ *
+ * @param   format   name of the format
+ *
+ * @return           true if the format is "ps", "svg", "pdf", "binary",
+ *                   "binary32" or "binary64"
+ */
+bool isWriterFormat(const std::string& format);
+// end CurveWriter.h
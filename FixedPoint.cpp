@@ -0,0 +1,87 @@
+/**
+ * FixedPoint.cpp
+ *
+ * Implementations for the FixedPoint class, a 32-bit fixed-point 
+ * coordinate with 16 fraction bits.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include <stdexcept>
+#include "FixedPoint.h"
+
+// storage for the constant, needed where it is bound to a reference
+constexpr double FixedPoint::LIMIT;
+
+/**
+ * Constructor for FixedPoint class, which rounds a value to the
+ * nearest fixed-point number
+ *
+ * @param   value    coordinate to store
+ *
+ * @throw   std::invalid_argument if the magnitude of the value is
+ *          larger than LIMIT or the value is not a number
+ */
+FixedPoint::FixedPoint(double value) {
+   if (!(std::fabs(value) <= LIMIT)) {
+      throw std::invalid_argument("Coordinate is out of fixed-point range");
+   }
+   raw = (std::int32_t) std::lround(std::ldexp(value, FRACTION_BITS));
+}
+
+/**
+ * Retrieves the FixedPoint with the specified raw value
+ *
+ * @param   raw      value times 2^FRACTION_BITS
+ *
+ * @return           the FixedPoint
+ */
+FixedPoint FixedPoint::fromRaw(std::int32_t raw) {
+   FixedPoint value;
+   value.raw = raw;
+   return value;
+}
+
+/**
+ * Retrieves the raw value of this FixedPoint
+ *
+ * @return  value times 2^FRACTION_BITS
+ */
+std::int32_t FixedPoint::getRaw() const {
+   return raw;
+}
+
+/**
+ * Converts this FixedPoint to a double, which is exact
+ *
+ * @return  value of this FixedPoint
+ */
+FixedPoint::operator double() const {
+   return std::ldexp((double) raw, -FRACTION_BITS);
+}
+
+/**
+ * Overloads the equality operator for use with FixedPoint objects
+ *
+ * @param   rhs   FixedPoint on the right hand side of this operator
+ *
+ * @return        true if the raw values are equal
+ */
+bool FixedPoint::operator==(const FixedPoint& rhs) const {
+   return raw == rhs.raw;
+}
+
+/**
+ * Overloads the output stream operator for use with FixedPoint 
+ * objects, writing the value as a double
+ *
+ * @param   output   output to stream the FixedPoint to
+ * @param   value    the FixedPoint
+ *
+ * @return           output stream
+ */
+std::ostream& operator<<(std::ostream& output, FixedPoint value) {
+   output << (double) value;
+   return output;
+} // end FixedPoint.cpp
@@ -0,0 +1,95 @@
+/**
+ * FixedPoint.h
+ *
+ * Declarations for the FixedPoint class, a 32-bit fixed-point 
+ * coordinate with 16 fraction bits. Coordinates between -LIMIT and
+ * LIMIT are stored to within 2^-17, in half the space of a double.
+ * FixedPoint has no arithmetic of its own; BasicPoint<FixedPoint>
+ * computes its Koch steps on the raw values in 64-bit integers.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+
+/**
+ * Represents a coordinate stored as a 32-bit fixed-point number
+ */
+class FixedPoint {
+public:
+   /** number of fraction bits of the raw value */
+   static const int FRACTION_BITS = 16;
+   /** largest magnitude of a coordinate */
+   static constexpr double LIMIT = 32767;
+
+   /**
+    * Default constructor for FixedPoint class
+    */
+   FixedPoint() = default;
+
+   /**
+    * Constructor for FixedPoint class, which rounds a value to the
+    * nearest fixed-point number
+    *
+    * @param   value    coordinate to store
+    *
+    * @throw   std::invalid_argument if the magnitude of the value is
+    *          larger than LIMIT or the value is not a number
+    */
+   explicit FixedPoint(double value);
+
+   /**
+    * Retrieves the FixedPoint with the specified raw value
+    *
+    * @param   raw      value times 2^FRACTION_BITS
+    *
+    * @return           the FixedPoint
+    */
+   static FixedPoint fromRaw(std::int32_t raw);
+
+   /**
+    * Retrieves the raw value of this FixedPoint
+    *
+    * @return  value times 2^FRACTION_BITS
+    */
+   std::int32_t getRaw() const;
+
+   /**
+    * Converts this FixedPoint to a double, which is exact
+    *
+    * @return  value of this FixedPoint
+    */
+   explicit operator double() const;
+
+   /**
+    * Overloads the equality operator for use with FixedPoint objects
+    *
+    * @param   rhs   FixedPoint on the right hand side of this operator
+    *
+    * @return        true if the raw values are equal
+    */
+   bool operator==(const FixedPoint& rhs) const;
+
+private:
+   /** value times 2^FRACTION_BITS */
+   std::int32_t raw;
+};
+
+// FixedPoints are stored in Points, which are copied with memcpy
+static_assert(std::is_trivially_copyable<FixedPoint>::value,
+   "FixedPoint must be trivially copyable");
+
+/**
+ * Overloads the output stream operator for use with FixedPoint 
+ * objects, writing the value as a double
+ *
+ * @param   output   output to stream the FixedPoint to
+ * @param   value    the FixedPoint
+ *
+ * @return           output stream
+ */
+std::ostream& operator<<(std::ostream& output, FixedPoint value);
+// end FixedPoint.h
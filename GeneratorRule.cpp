@@ -0,0 +1,228 @@
+/**
+ * GeneratorRule.cpp
+ *
+ * Implementations for the GeneratorRule class, which describes how
+ * one step of a self-similar curve replaces a segment by a chain of
+ * sub-segments.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include "GeneratorRule.h"
+
+namespace {
+   /** radians in a degree */
+   const double RADIANS = std::acos(-1.0) / 180;
+}
+
+/**
+ * Constructor for GeneratorRule class, which is the koch rule
+ */
+GeneratorRule::GeneratorRule() : GeneratorRule("koch", {
+   { 1.0 / 3, 0 }, { 1.0 / 3, 60 }, { 1.0 / 3, -60 }, { 1.0 / 3, 0 } }) {
+   koch = true;
+}
+
+/**
+ * Constructor for GeneratorRule class, which compiles a table of
+ * sub-segments
+ *
+ * @param   name     name of the rule
+ * @param   steps    sub-segments in curve order
+ *
+ * @throw   std::invalid_argument if there are fewer than 2 or more
+ *          than MAX_SEGMENTS steps, or the chain returns to its
+ *          start
+ */
+GeneratorRule::GeneratorRule(const std::string& name,
+   const std::vector<RuleStep>& steps) :
+   name(name), koch(false), segmentCount((int) steps.size()) {
+
+   if (segmentCount < 2 || segmentCount > MAX_SEGMENTS) {
+      throw std::invalid_argument("A rule needs 2 to 16 segments");
+   }
+
+   // corners of the chain drawn from (0,0) along the X axis
+   double xs[MAX_SEGMENTS + 1] = { 0 };
+   double ys[MAX_SEGMENTS + 1] = { 0 };
+   for (int i = 0; i < segmentCount; i++) {
+      double angle = steps[i].rotation * RADIANS;
+      xs[i + 1] = xs[i] + steps[i].scale * std::cos(angle);
+      ys[i + 1] = ys[i] + steps[i].scale * std::sin(angle);
+   }
+
+   double xEnd = xs[segmentCount];
+   double yEnd = ys[segmentCount];
+   double norm = xEnd * xEnd + yEnd * yEnd;
+   if (!(norm > 1e-12)) {
+      throw std::invalid_argument("Rule " + name + " returns to its start");
+   }
+
+   // divide by the end of the chain, so that it ends at (1,0)
+   for (int i = 1; i < segmentCount; i++) {
+      alongs[i] = (xs[i] * xEnd + ys[i] * yEnd) / norm;
+      acrosses[i] = (ys[i] * xEnd - xs[i] * yEnd) / norm;
+   }
+}
+
+/**
+ * Retrieves a rule by name: koch, quadratic (5 segments at right
+ * angles), cesaro:ANGLE (koch with a tip rising at ANGLE degrees,
+ * 0 < ANGLE <= 90), levy (Levy C curve) or minkowski (8 segment
+ * sausage). A custom table is written scale:rotation,...
+ *
+ * @param   name     name of the rule or a custom table
+ *
+ * @return           the rule
+ *
+ * @throw   std::invalid_argument if the name is unknown or the
+ *          table is invalid
+ */
+GeneratorRule GeneratorRule::named(const std::string& name) {
+   const double third = 1.0 / 3;
+   const double quarter = 1.0 / 4;
+
+   if (name == "koch") {
+      return GeneratorRule();
+   }
+   if (name == "quadratic") {
+      return GeneratorRule(name, { { third, 0 }, { third, 90 },
+         { third, 0 }, { third, -90 }, { third, 0 } });
+   }
+   if (name == "levy") {
+      return GeneratorRule(name, { { std::sqrt(0.5), 45 },
+         { std::sqrt(0.5), -45 } });
+   }
+   if (name == "minkowski") {
+      return GeneratorRule(name, { { quarter, 0 }, { quarter, 90 },
+         { quarter, 0 }, { quarter, -90 }, { quarter, -90 },
+         { quarter, 0 }, { quarter, 90 }, { quarter, 0 } });
+   }
+   if (name.compare(0, 7, "cesaro:") == 0) {
+      char* end;
+      double angle = std::strtod(name.c_str() + 7, &end);
+      if (name.size() == 7 || *end != '\0' || !(angle > 0) ||
+         angle > 90) {
+         throw std::invalid_argument("Cesaro angle must be in (0, 90]");
+      }
+
+      // four equal segments whose tip rises at the angle span the
+      // segment when 2 + 2 cos(angle) of them fit in it
+      double scale = 1 / (2 + 2 * std::cos(angle * RADIANS));
+      return GeneratorRule(name, { { scale, 0 }, { scale, angle },
+         { scale, -angle }, { scale, 0 } });
+   }
+
+   // custom tables are scale:rotation pairs separated by commas
+   std::vector<RuleStep> steps;
+   std::istringstream table(name);
+   RuleStep step;
+   char separator;
+
+   while (table >> step.scale >> separator >> step.rotation &&
+      separator == ':') {
+      steps.push_back(step);
+
+      if (!(table >> separator)) {
+         return GeneratorRule(name, steps);
+      }
+      if (separator != ',') {
+         break;
+      }
+   }
+   throw std::invalid_argument("Unknown rule " + name);
+}
+
+/**
+ * Retrieves the name of the rule
+ *
+ * @return  name of the rule
+ */
+const std::string& GeneratorRule::getName() const {
+   return name;
+}
+
+/**
+ * Determines if this is the koch rule, which splits with
+ * Point::kochStep
+ *
+ * @return  true for the koch rule
+ */
+bool GeneratorRule::isKoch() const {
+   return koch;
+}
+
+/**
+ * Retrieves the number of sub-segments a segment is split into
+ *
+ * @return  number of sub-segments
+ */
+int GeneratorRule::getSegmentCount() const {
+   return segmentCount;
+}
+
+/**
+ * Retrieves the number of segments of a curve of the specified
+ * level, which is getSegmentCount()^level
+ *
+ * @pre             the count fits in 63 bits
+ *
+ * @param   level   level of the curve
+ *
+ * @return          number of segments
+ */
+long long GeneratorRule::countSegments(int level) const {
+   long long count = 1;
+   for (int i = 0; i < level; i++) {
+      count *= segmentCount;
+   }
+   return count;
+}
+
+/**
+ * Determines the highest level whose number of points fits in 63
+ * bits
+ *
+ * @return  highest level
+ */
+int GeneratorRule::getMaxLevel() const {
+   int level = 0;
+   long long count = 1;
+   while (count <= (INT64_MAX - 1) / segmentCount) {
+      count *= segmentCount;
+      level++;
+   }
+   return level;
+}
+
+/**
+ * Divides a segment into its sub-segments
+ *
+ * @param   start    first point of the segment
+ * @param   end      last point of the segment
+ * @param   corners  receives getSegmentCount() + 1 corners from
+ *                   start to end
+ */
+void GeneratorRule::split(const Point& start, const Point& end,
+   Point* corners) const {
+
+   corners[0] = start;
+   corners[segmentCount] = end;
+
+   if (koch) {
+      start.kochStep(end, corners[1], corners[2], corners[3]);
+      return;
+   }
+
+   double xDelta = end.getXCoord() - start.getXCoord();
+   double yDelta = end.getYCoord() - start.getYCoord();
+   for (int i = 1; i < segmentCount; i++) {
+      corners[i] = Point(
+         start.getXCoord() + (alongs[i] * xDelta - acrosses[i] * yDelta),
+         start.getYCoord() + (acrosses[i] * xDelta + alongs[i] * yDelta));
+   }
+} // end GeneratorRule.cpp
@@ -0,0 +1,141 @@
+/**
+ * GeneratorRule.h
+ *
+ * Declarations for the GeneratorRule class, which describes how one
+ * step of a self-similar curve replaces a segment by a chain of
+ * sub-segments. The rule is a table of (scale, rotation) steps: each
+ * sub-segment is the segment scaled and rotated counterclockwise by
+ * the given number of degrees, placed at the end of the one before.
+ * The table is compiled once into the positions of the inner corners
+ * as fractions of the segment, normalized so that the chain ends at
+ * the end of the segment, and every split is then one complex
+ * multiply-add per corner.
+ *
+ * The koch rule splits with Point::kochStep, so curves drawn with it
+ * are exactly those drawn without a rule.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Point.h"
+
+/**
+ * Represents one sub-segment of a generator rule
+ */
+struct RuleStep {
+   /** length of the sub-segment relative to the segment */
+   double scale;
+   /** counterclockwise rotation from the segment in degrees */
+   double rotation;
+};
+
+/**
+ * Represents the generator of a self-similar curve
+ */
+class GeneratorRule {
+public:
+   /** largest number of sub-segments of a rule */
+   static const int MAX_SEGMENTS = 16;
+
+   /**
+    * Constructor for GeneratorRule class, which is the koch rule
+    */
+   GeneratorRule();
+
+   /**
+    * Constructor for GeneratorRule class, which compiles a table of
+    * sub-segments
+    *
+    * @param   name     name of the rule
+    * @param   steps    sub-segments in curve order
+    *
+    * @throw   std::invalid_argument if there are fewer than 2 or more
+    *          than MAX_SEGMENTS steps, or the chain returns to its
+    *          start
+    */
+   GeneratorRule(const std::string& name,
+      const std::vector<RuleStep>& steps);
+
+   /**
+    * Retrieves a rule by name: koch, quadratic (5 segments at right
+    * angles), cesaro:ANGLE (koch with a tip rising at ANGLE degrees,
+    * 0 < ANGLE <= 90), levy (Levy C curve) or minkowski (8 segment
+    * sausage). A custom table is written scale:rotation,...
+    *
+    * @param   name     name of the rule or a custom table
+    *
+    * @return           the rule
+    *
+    * @throw   std::invalid_argument if the name is unknown or the
+    *          table is invalid
+    */
+   static GeneratorRule named(const std::string& name);
+
+   /**
+    * Retrieves the name of the rule
+    *
+    * @return  name of the rule
+    */
+   const std::string& getName() const;
+
+   /**
+    * Determines if this is the koch rule, which splits with
+    * Point::kochStep
+    *
+    * @return  true for the koch rule
+    */
+   bool isKoch() const;
+
+   /**
+    * Retrieves the number of sub-segments a segment is split into
+    *
+    * @return  number of sub-segments
+    */
+   int getSegmentCount() const;
+
+   /**
+    * Retrieves the number of segments of a curve of the specified
+    * level, which is getSegmentCount()^level
+    *
+    * @pre             the count fits in 63 bits
+    *
+    * @param   level   level of the curve
+    *
+    * @return          number of segments
+    */
+   long long countSegments(int level) const;
+
+   /**
+    * Determines the highest level whose number of points fits in 63
+    * bits
+    *
+    * @return  highest level
+    */
+   int getMaxLevel() const;
+
+   /**
+    * Divides a segment into its sub-segments
+    *
+    * @param   start    first point of the segment
+    * @param   end      last point of the segment
+    * @param   corners  receives getSegmentCount() + 1 corners from
+    *                   start to end
+    */
+   void split(const Point& start, const Point& end, Point* corners) const;
+
+private:
+   /** name of the rule */
+   std::string name;
+   /** true if the rule splits with Point::kochStep */
+   bool koch;
+   /** number of sub-segments */
+   int segmentCount;
+   /** position of every inner corner along the segment */
+   double alongs[MAX_SEGMENTS];
+   /** position of every inner corner to the left of the segment */
+   double acrosses[MAX_SEGMENTS];
+}; // end GeneratorRule.h
@@ -7,9 +7,16 @@
  * Joshua Scheck
  * 2020-11-20
  */
+#include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <vector>
 #include "KochGenerator.h"
+#include "KochTable.h"
+#include "PostScriptWriter.h"
+#include "ThreadPool.h"
 
 /**
  * Constructor for KochGenerator class
@@ -21,11 +28,182 @@
  * @param   level Koch level to draw
  */
 KochGenerator::KochGenerator(double x1, double y1, double x2, 
-   double y2, int level) {
+   double y2, int level) : 
+   KochGenerator(x1, y1, x2, y2, level, KochOptions()) {}
+
+/**
+ * Retrieves the default options with streaming set
+ *
+ * @return  options of a streaming KochGenerator
+ */
+KochOptions KochOptions::streamed() {
+   KochOptions options;
+   options.streaming = true;
+   return options;
+}
+
+/**
+ * Constructor for KochGenerator class, which draws the curve as
+ * the specified KochOptions describe
+ * 
+ * @param   x1        X coordinate of first point
+ * @param   y1        Y coordinate of first point
+ * @param   x2        X coordinate of second point
+ * @param   y2        Y coordinate of second point
+ * @param   level     level to draw
+ * @param   options   how the curve is drawn and stored
+ */
+KochGenerator::KochGenerator(double x1, double y1, double x2, 
+   double y2, int level, const KochOptions& options) : 
+   streaming(options.streaming), threadCount(options.threadCount), 
+   resolution(options.resolution), rule(options.rule), 
+   koch(options.rule.isKoch()), 
+   segmentCount(options.rule.getSegmentCount()), tableXCoords(nullptr),
+   tableYCoords(nullptr) {
    
    firstPoint = Point(x1, y1);
+   lastPoint = Point(x2, y2);
    curveLevel = level;
-   drawKoch(x1, y1, x2, y2, level);
+
+   // small Koch curves may be one affine transform of their table
+   if (options.tabled && koch && resolution == 0 && level >= 0 && 
+      level <= MAX_TABLE_LEVEL) {
+      tableXCoords = kochTableXCoords(level);
+      tableYCoords = kochTableYCoords(level);
+   }
+
+   if (!streaming) {
+      // a curve has exactly n^level points, so size the Queue once 
+      // when the count fits; otherwise the Queue grows as needed
+      if (resolution == 0 && level <= rule.getMaxLevel() &&
+         rule.countSegments(level) <= (1 << 30)) {
+         points.reserve((int) rule.countSegments(level));
+      }
+
+      QueueSink sink(points);
+      generate(sink);
+   }
+}
+
+/**
+ * Determines if this KochGenerator streams its points instead of
+ * storing them
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  true if points are not stored, false otherwise
+ */
+bool KochGenerator::isStreaming() const {
+   return streaming;
+}
+
+/**
+ * Retrieves the number of threads drawing the curve
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  number of threads
+ */
+int KochGenerator::getThreadCount() const {
+   return threadCount;
+}
+
+/**
+ * Retrieves the Koch level of the curve
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  Koch curve level
+ */
+int KochGenerator::getCurveLevel() const {
+   return curveLevel;
+}
+
+/**
+ * Retrieves the length below which segments are no longer divided
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  resolution, or 0 if every segment is divided
+ */
+double KochGenerator::getResolution() const {
+   return resolution;
+}
+
+/**
+ * Retrieves the generator of the curve
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  generator rule
+ */
+const GeneratorRule& KochGenerator::getRule() const {
+   return rule;
+}
+
+/**
+ * Retrieves the first point of the curve
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  first point of the curve
+ */
+Point KochGenerator::getFirstPoint() const {
+   return firstPoint;
+}
+
+/**
+ * Retrieves the last point of the curve
+ *
+ * @pre     KochGenerator must be initialized
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  last point of the curve
+ */
+Point KochGenerator::getLastPoint() const {
+   return lastPoint;
+}
+
+/**
+ * Generates the whole Koch curve of this KochGenerator into the
+ * specified PointSink, starting with begin() and finishing with
+ * end(). Tabled curves are mapped from their KochTable on this
+ * thread.
+ *
+ * @pre            KochGenerator must be initialized
+ *
+ * @post           state of this KochGenerator does not change
+ * 
+ * @param   sink   PointSink receiving the points of the curve
+ */
+void KochGenerator::generate(PointSink& sink) const {
+   sink.begin(firstPoint, curveLevel);
+
+   if (tableXCoords != nullptr) {
+      drawTable(1, getPointCount(), sink);
+   }
+   else if (threadCount > 1 && curveLevel > 1) {
+      drawKochParallel(sink);
+   }
+   else {
+      drawKoch(firstPoint.getXCoord(), firstPoint.getYCoord(),
+         lastPoint.getXCoord(), lastPoint.getYCoord(), curveLevel, sink);
+   }
+
+   sink.end();
 }
 
 /**
@@ -43,42 +221,370 @@ KochGenerator::KochGenerator(double x1, double y1, double x2,
  */
 void KochGenerator::drawKoch(double x1, double y1, double x2, double y2, int level)
 {
-   if (level <= 0)
+   QueueSink sink(points);
+   drawKoch(x1, y1, x2, y2, level, sink);
+}
+
+/**
+ * Recursively hands points representing Koch curve to the specified
+ * PointSink in curve order, drawing segments shorter than the 
+ * resolution as straight lines
+ *
+ * @pre            KochGenerator must be initialized
+ *
+ * @post           state of this KochGenerator does not change
+ * 
+ * @param   x1     X coordinate of first point
+ * @param   y1     Y coordinate of first point
+ * @param   x2     X coordinate of second point
+ * @param   y2     Y coordinate of second point
+ * @param   level  Koch level to draw
+ * @param   sink   PointSink receiving the points
+ */
+void KochGenerator::drawKoch(double x1, double y1, double x2, double y2, 
+   int level, PointSink& sink) const
+{
+   // segments shorter than the resolution are drawn straight
+   double resolution = this->resolution;
+   auto isStraight = [resolution](const Point& start, const Point& end) {
+      double dx = end.getXCoord() - start.getXCoord();
+      double dy = end.getYCoord() - start.getYCoord();
+      return resolution > 0 && dx * dx + dy * dy < resolution * resolution;
+   };
+
+   if (level <= 0 || isStraight(Point(x1, y1), Point(x2, y2)))
+   {
+      sink.addPoint(Point(x2, y2));
+   }
+   else if (koch)
    {
-      points.push(Point(x2, y2));
+      drawKochCurve(Point(x1, y1), Point(x2, y2), level, sink, 
+         isStraight);
    }
    else
    {
-      // create end points for this recursive call
-      Point initialPoint = Point(x1, y1);
-      Point lastPoint = Point(x2, y2);
+      Point corners[GeneratorRule::MAX_SEGMENTS + 1];
+      rule.split(Point(x1, y1), Point(x2, y2), corners);
 
-      // section koch curve into thirds
-      Point firstThird = initialPoint.section(1, 2, lastPoint);
-      Point secondThird = firstThird.section(1, 1, lastPoint);
-      
-      // draw first third
-      drawKoch(x1, y1, firstThird.getXCoord(), firstThird.getYCoord(),
-         level-1);
+      // draw the sub-segments in curve order
+      for (int i = 0; i < segmentCount; i++) {
+         drawKoch(corners[i].getXCoord(), corners[i].getYCoord(),
+            corners[i + 1].getXCoord(), corners[i + 1].getYCoord(), 
+            level-1, sink);
+      }
+   }
+}
+
+/**
+ * Retrieves the number of points in the Koch curve, including the
+ * first point, which is 4^level + 1, or n^level + 1 for a rule of
+ * n sub-segments
+ *
+ * @pre     KochGenerator must be initialized with level at most
+ *          getRule().getMaxLevel() and a resolution of 0
+ *
+ * @post    state of this KochGenerator does not change
+ *
+ * @return  number of points in the curve
+ */
+long long KochGenerator::getPointCount() const {
+   return rule.countSegments(curveLevel) + 1;
+}
+
+/**
+ * Retrieves the point at the specified index of the Koch curve, 
+ * where index 0 is the first point. The base 4 digits of the index
+ * (base n for a rule of n sub-segments) select which sub-curve to
+ * descend into on each level, so only O(level) points are 
+ * computed, and tabled curves read the point from their KochTable.
+ * The result is identical to the point generate() produces at 
+ * that index. The resolution is not applied.
+ *
+ * @pre            KochGenerator must be initialized and index must
+ *                 be less than getPointCount()
+ *
+ * @post           state of this KochGenerator does not change
+ * 
+ * @param   index  index of the point in the curve
+ *
+ * @return         point at the index
+ */
+Point KochGenerator::pointAt(long long index) const {
+   if (index <= 0) {
+      return firstPoint;
+   }
+   if (tableXCoords != nullptr) {
+      return tablePointAt(index);
+   }
+
+   // point index is the end point of sub-curve index - 1
+   long long subCurve = index - 1;
+   Point start = firstPoint;
+   Point end = lastPoint;
+   Point corners[GeneratorRule::MAX_SEGMENTS + 1];
+   int base = rule.getSegmentCount();
+   long long size = rule.countSegments(curveLevel);
+
+   for (int level = curveLevel; level > 0; level--) {
+      size /= base;
+      int digit = (int) ((subCurve / size) % base);
+
+      rule.split(start, end, corners);
+      start = corners[digit];
+      end = corners[digit + 1];
+   }
+   return end;
+}
 
-      // draw tip of equalaterial triangle in middle
-      Point angledPoint = firstThird.rotate(-60, secondThird);
-      drawKoch(firstThird.getXCoord(), firstThird.getYCoord(), 
-         angledPoint.getXCoord(), angledPoint.getYCoord(), level-1);
-      drawKoch(angledPoint.getXCoord(), angledPoint.getYCoord(), 
-         secondThird.getXCoord(), secondThird.getYCoord(), level-1);
-      
-      // draw last third
-      drawKoch(secondThird.getXCoord(), secondThird.getYCoord(), 
-         lastPoint.getXCoord(), lastPoint.getYCoord(), level-1);
+/**
+ * Hands the points with indices in the half-open range 
+ * [first, last) to the specified PointSink in curve order, 
+ * skipping every sub-curve outside the range. Only addPoint() is 
+ * called on the sink, and the resolution is not applied.
+ *
+ * @pre            KochGenerator must be initialized and 
+ *                 first <= last <= getPointCount()
+ *
+ * @post           state of this KochGenerator does not change
+ * 
+ * @param   first  index of the first point to generate
+ * @param   last   index one past the last point to generate
+ * @param   sink   PointSink receiving the points
+ */
+void KochGenerator::generateRange(long long first, long long last, 
+   PointSink& sink) const {
+
+   if (first >= last) {
+      return;
+   }
+   if (tableXCoords != nullptr) {
+      drawTable(first, last, sink);
+      return;
+   }
+   if (first == 0) {
+      sink.addPoint(firstPoint);
+   }
+   drawKochRange(firstPoint.getXCoord(), firstPoint.getYCoord(),
+      lastPoint.getXCoord(), lastPoint.getYCoord(), curveLevel, 1,
+      first, last, sink);
+}
+
+/**
+* Recursively hands the points of a sub-curve whose indices fall in
+* the half-open range [first, last) to the specified PointSink
+*
+* @param   x1      X coordinate of first point
+* @param   y1      Y coordinate of first point
+* @param   x2      X coordinate of second point
+* @param   y2      Y coordinate of second point
+* @param   level   Koch level to draw
+* @param   offset  index of the first point of the sub-curve
+* @param   first   index of the first point to generate
+* @param   last    index one past the last point to generate
+* @param   sink    PointSink receiving the points
+*/
+void KochGenerator::drawKochRange(double x1, double y1, double x2, 
+   double y2, int level, long long offset, long long first, 
+   long long last, PointSink& sink) const {
 
+   long long count = rule.countSegments(level);
+
+   // skip sub-curves entirely outside the range
+   if (offset >= last || offset + count <= first) {
+      return;
+   }
+   if (level <= 0) {
+      sink.addPoint(Point(x2, y2));
+      return;
+   }
+   // draw sub-curves entirely inside the range without index checks,
+   // unless drawKoch would stop early at the resolution
+   if (resolution == 0 && offset >= first && offset + count <= last) {
+      drawKoch(x1, y1, x2, y2, level, sink);
+      return;
+   }
+
+   Point corners[GeneratorRule::MAX_SEGMENTS + 1];
+   rule.split(Point(x1, y1), Point(x2, y2), corners);
+
+   long long part = count / rule.getSegmentCount();
+   for (int i = 0; i < rule.getSegmentCount(); i++) {
+      drawKochRange(corners[i].getXCoord(), corners[i].getYCoord(),
+         corners[i + 1].getXCoord(), corners[i + 1].getYCoord(), 
+         level-1, offset + i * part, first, last, sink);
+   }
+}
+
+/**
+ * Retrieves the point at the specified index of a curve drawn from
+ * its KochTable, mapping the unit curve onto the first and last
+ * points
+ *
+ * @pre            the curve has a KochTable and index must be less
+ *                 than getPointCount()
+ *
+ * @param   index  index of the point in the curve
+ *
+ * @return         point at the index
+ */
+Point KochGenerator::tablePointAt(long long index) const {
+   // the ends are exact, so that neighbouring curves meet
+   if (index == 0) {
+      return firstPoint;
+   }
+   if (index == getPointCount() - 1) {
+      return lastPoint;
+   }
+
+   // same arithmetic as the affine kernels of a TemplateCache
+   double xScale = lastPoint.getXCoord() - firstPoint.getXCoord();
+   double yScale = lastPoint.getYCoord() - firstPoint.getYCoord();
+   double u = tableXCoords[index];
+   double v = tableYCoords[index];
+   return Point(firstPoint.getXCoord() + (xScale * u - yScale * v),
+      firstPoint.getYCoord() + (yScale * u + xScale * v));
+}
+
+/**
+ * Hands the points of a curve drawn from its KochTable with 
+ * indices in the half-open range [first, last) to the specified
+ * PointSink
+ *
+ * @pre            the curve has a KochTable and 
+ *                 first <= last <= getPointCount()
+ *
+ * @param   first  index of the first point to generate
+ * @param   last   index one past the last point to generate
+ * @param   sink   PointSink receiving the points
+ */
+void KochGenerator::drawTable(long long first, long long last, 
+   PointSink& sink) const {
+
+   long long lastIndex = getPointCount() - 1;
+   if (first == 0) {
+      sink.addPoint(firstPoint);
+      first = 1;
+   }
+
+   double xOffset = firstPoint.getXCoord();
+   double yOffset = firstPoint.getYCoord();
+   double xScale = lastPoint.getXCoord() - xOffset;
+   double yScale = lastPoint.getYCoord() - yOffset;
+   long long inner = last < lastIndex ? last : lastIndex;
+
+   for (long long index = first; index < inner; index++) {
+      double u = tableXCoords[index];
+      double v = tableYCoords[index];
+      sink.addPoint(Point(xOffset + (xScale * u - yScale * v),
+         yOffset + (yScale * u + xScale * v)));
+   }
+   if (last > lastIndex) {
+      sink.addPoint(lastPoint);
+   }
+}
+
+/**
+ * Generates the points of the whole Koch curve into the specified
+ * PointSink using threadCount threads. The curve is split into 
+ * subtrees whose points are drawn into separate Queues on a 
+ * ThreadPool; each Queue is handed to the sink in curve order as 
+ * soon as it and all Queues before it are complete. At most twice
+ * threadCount subtrees are drawn or waiting at a time.
+ *
+ * @pre            KochGenerator must be initialized
+ *
+ * @post           state of this KochGenerator does not change
+ * 
+ * @param   sink   PointSink receiving the points of the curve
+ */
+void KochGenerator::drawKochParallel(PointSink& sink) const {
+   // split the top levels into enough subtrees to keep every thread
+   // busy while stealing evens out their run times
+   int splitLevel = 1;
+   while (splitLevel < curveLevel && 
+      rule.countSegments(splitLevel) < threadCount * 16) {
+      splitLevel++;
+   }
+   int subtreeLevel = curveLevel - splitLevel;
+
+   // the end points of a level splitLevel curve are the end points 
+   // of the subtrees, computed exactly as the full recursion would
+   Queue<Point> ends;
+   QueueSink endSink(ends);
+   drawKoch(firstPoint.getXCoord(), firstPoint.getYCoord(),
+      lastPoint.getXCoord(), lastPoint.getYCoord(), splitLevel, endSink);
+
+   // subtree i runs from corners[i] to corners[i + 1]
+   int subtreeCount = ends.getCurrentSize();
+   std::vector<Point> corners(1, firstPoint);
+   for (const Point& end : ends) {
+      corners.push_back(end);
+   }
+
+   std::vector<Queue<Point> > segments(subtreeCount);
+   std::vector<bool> finished(subtreeCount, false);
+   std::mutex finishedLock;
+   std::condition_variable segmentFinished;
+
+   {
+      ThreadPool pool(threadCount);
+
+      auto submitSubtree = [this, &pool, &corners, subtreeLevel, 
+         &segments, &finished, &finishedLock, &segmentFinished](int i) {
+         pool.submit([this, i, &corners, subtreeLevel, &segments,
+            &finished, &finishedLock, &segmentFinished] {
+            Queue<Point>& segment = segments[i];
+            if (rule.countSegments(subtreeLevel) <= (1 << 30)) {
+               segment.reserve((int) rule.countSegments(subtreeLevel));
+            }
+
+            QueueSink segmentSink(segment);
+            drawKoch(corners[i].getXCoord(), corners[i].getYCoord(), 
+               corners[i + 1].getXCoord(), corners[i + 1].getYCoord(), 
+               subtreeLevel, segmentSink);
+
+            std::lock_guard<std::mutex> guard(finishedLock);
+            finished[i] = true;
+            segmentFinished.notify_all();
+         });
+      };
+
+      // only a window of subtrees is drawn ahead of the sink, so at 
+      // most window Queues of points are held at a time however 
+      // slowly the sink consumes them
+      int window = std::min(subtreeCount, 2 * threadCount);
+      for (int i = 0; i < window; i++) {
+         submitSubtree(i);
+      }
+
+      // stitch segments together in curve order while later ones
+      // are still being drawn
+      for (int i = 0; i < subtreeCount; i++) {
+         {
+            std::unique_lock<std::mutex> guard(finishedLock);
+            segmentFinished.wait(guard, [&finished, i] { 
+               return finished[i]; 
+            });
+         }
+
+         for (const Point& point : segments[i]) {
+            sink.addPoint(point);
+         }
+         segments[i].clear();
+
+         if (i + window < subtreeCount) {
+            submitSubtree(i + window);
+         }
+      }
    }
 }
 
 /**
  * Overloads the output stream operator for use with KochGenerator 
  * objects. Allows for outputting the values of this KochGenerator 
- * into the output stream.
+ * into the output stream. Stored points are read in place, so the
+ * KochGenerator is neither copied nor emptied and can be output
+ * again.
  *
  * @pre                    KochGenerator must be initialized
  *
@@ -92,55 +598,22 @@ void KochGenerator::drawKoch(double x1, double y1, double x2, double y2, int lev
  * @return                 output stream
  */
 std::ostream& operator<<(std::ostream& output,
-   KochGenerator kochGenerator) {
+   const KochGenerator& kochGenerator) {
    
-   output << "%!PS-Adobe-2.0" << std::endl;
-
-   int initialXVal = round(kochGenerator.firstPoint.getXCoord());
-   int initialYVal = round(kochGenerator.firstPoint.getYCoord());
+   PostScriptWriter writer(output);
 
-   output << initialXVal << "\t" << initialYVal << "\t" <<  
-      "moveto" << std::endl;
-   
-   if (kochGenerator.curveLevel == 0) {
-      Point currPoint = kochGenerator.points.front();
+   if (kochGenerator.streaming) {
+      kochGenerator.generate(writer);
+      return output;
+   }
 
-      int adjustedXVal = round(currPoint.getXCoord());
-      int adjustedYVal = round(currPoint.getYCoord());
+   writer.begin(kochGenerator.firstPoint, kochGenerator.curveLevel);
 
-      output << adjustedXVal << "\t" << 
-         adjustedYVal << "\t" << "lineto" << std::endl;
-      
-      // remove top Point of the queue
-      kochGenerator.points.pop();
-   }
-   else {
-      double priorXCoord = kochGenerator.firstPoint.getXCoord();
-      double priorYCoord = kochGenerator.firstPoint.getYCoord();
-
-      while(!kochGenerator.points.isEmpty()) {
-         Point currPoint = kochGenerator.points.front();
-
-         int adjustedXVal = round(currPoint.getXCoord() - 
-            priorXCoord);
-         int adjustedYVal = round(currPoint.getYCoord() - 
-            priorYCoord);
-
-         // output adjusted coordinates
-         output << adjustedXVal << "\t" << 
-            adjustedYVal << "\t" << "rlineto" << std::endl;
-         
-         // assign prior point coordinates
-         priorXCoord = currPoint.getXCoord();
-         priorYCoord = currPoint.getYCoord();
-
-         // remove top Point of the queue
-         kochGenerator.points.pop();
-      }
+   for (const Point& point : kochGenerator.points) {
+      writer.addPoint(point);
    }
 
-   output << "stroke" << std::endl;
-   output << "showpage" << std::endl;
+   writer.end();
 
    return output;
-} // end KochGenerator.cpp
\ No newline at end of file
+} // end KochGenerator.cpp
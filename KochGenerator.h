@@ -10,8 +10,79 @@
 
 #pragma once
 #include <iostream>
+#include "GeneratorRule.h"
 #include "Queue.h"
 #include "Point.h"
+#include "PointSink.h"
+
+/**
+ * Recursively hands the points of a Koch curve after its first to the
+ * specified sink in curve order. Every Koch step is computed by
+ * BasicPoint<Coord>::kochStep in the precision of the coordinates, so
+ * KochGenerator and PrecisionGenerator share this one recursion.
+ *
+ * @param   start       first point of the curve
+ * @param   end         last point of the curve
+ * @param   level       Koch level to draw
+ * @param   sink        sink receiving the points
+ * @param   isStraight  predicate on the ends of a segment that is true
+ *                      if the segment is drawn straight before level 0
+ */
+template <typename Coord, typename StraightTest>
+void drawKochCurve(const BasicPoint<Coord>& start, 
+   const BasicPoint<Coord>& end, int level, BasicPointSink<Coord>& sink,
+   const StraightTest& isStraight) {
+
+   if (level <= 0 || isStraight(start, end)) {
+      sink.addPoint(end);
+      return;
+   }
+
+   BasicPoint<Coord> corners[5] = { start, BasicPoint<Coord>(), 
+      BasicPoint<Coord>(), BasicPoint<Coord>(), end };
+   start.kochStep(end, corners[1], corners[2], corners[3]);
+
+   // draw the four thirds in curve order
+   for (int i = 0; i < 4; i++) {
+      drawKochCurve(corners[i], corners[i + 1], level - 1, sink, 
+         isStraight);
+   }
+}
+
+/**
+ * Represents the ways a KochGenerator can draw and store its curve.
+ * The defaults store every point of the Koch curve, drawn by the 
+ * recursion on the calling thread.
+ */
+struct KochOptions {
+   /**
+    * Retrieves the default options with streaming set
+    *
+    * @return  options of a streaming KochGenerator
+    */
+   static KochOptions streamed();
+
+   /** true if points are not stored; they are generated each time 
+    * the curve is output, so that memory use is bounded by the 
+    * recursion depth rather than by the number of points */
+   bool streaming = false;
+   /** number of threads drawing the curve; the top levels are split
+    * into subtrees drawn in parallel and stitched back together in
+    * curve order, so the points are those of a single thread */
+   int threadCount = 1;
+   /** shortest segment that is still divided; shorter segments are 
+    * drawn straight, and 0 divides every segment down to level 0 */
+   double resolution = 0;
+   /** generator of the curve; every segment is split into 
+    * rule.getSegmentCount() sub-segments per level, so point 
+    * indices, ranges and shards count in that base */
+   GeneratorRule rule;
+   /** true if Koch curves of at most MAX_TABLE_LEVEL levels without a
+    * resolution are one affine transform of their KochTable, which
+    * is faster than the recursion but may round a few points 
+    * differently from it */
+   bool tabled = false;
+};
 
 /**
  * Represents a Point in a Koch curve
@@ -21,7 +92,9 @@ class KochGenerator {
 /**
  * Overloads the output stream operator for use with KochGenerator 
  * objects. Allows for outputting the values of this KochGenerator 
- * into the output stream.
+ * into the output stream. Stored points are read in place, so the
+ * KochGenerator is neither copied nor emptied and can be output
+ * again.
  *
  * @pre                    KochGenerator must be initialized
  *
@@ -35,7 +108,7 @@ class KochGenerator {
  * @return                 output stream
  */
 friend std::ostream& operator<<(std::ostream& output,
-   KochGenerator kochGenerator);
+   const KochGenerator& kochGenerator);
 
 public:
    /**
@@ -49,6 +122,164 @@ public:
     */
    KochGenerator(double x1, double y1, double x2, double y2, int level);
 
+   /**
+    * Constructor for KochGenerator class, which draws the curve as
+    * the specified KochOptions describe
+    * 
+    * @param   x1        X coordinate of first point
+    * @param   y1        Y coordinate of first point
+    * @param   x2        X coordinate of second point
+    * @param   y2        Y coordinate of second point
+    * @param   level     level to draw
+    * @param   options   how the curve is drawn and stored
+    */
+   KochGenerator(double x1, double y1, double x2, double y2, int level,
+      const KochOptions& options);
+
+   /**
+    * Determines if this KochGenerator streams its points instead of
+    * storing them
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  true if points are not stored, false otherwise
+    */
+   bool isStreaming() const;
+
+   /**
+    * Retrieves the number of threads drawing the curve
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  number of threads
+    */
+   int getThreadCount() const;
+
+   /**
+    * Retrieves the Koch level of the curve
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  Koch curve level
+    */
+   int getCurveLevel() const;
+
+   /**
+    * Retrieves the length below which segments are no longer divided
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  resolution, or 0 if every segment is divided
+    */
+   double getResolution() const;
+
+   /**
+    * Retrieves the generator of the curve
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  generator rule
+    */
+   const GeneratorRule& getRule() const;
+
+   /**
+    * Retrieves the first point of the curve
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  first point of the curve
+    */
+   Point getFirstPoint() const;
+
+   /**
+    * Retrieves the last point of the curve
+    *
+    * @pre     KochGenerator must be initialized
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  last point of the curve
+    */
+   Point getLastPoint() const;
+
+   /**
+    * Generates the whole Koch curve of this KochGenerator into the
+    * specified PointSink, starting with begin() and finishing with
+    * end(). Tabled curves are mapped from their KochTable on this
+    * thread.
+    *
+    * @pre            KochGenerator must be initialized
+    *
+    * @post           state of this KochGenerator does not change
+    * 
+    * @param   sink   PointSink receiving the points of the curve
+    */
+   void generate(PointSink& sink) const;
+
+   /**
+    * Retrieves the number of points in the Koch curve, including the
+    * first point, which is 4^level + 1, or n^level + 1 for a rule of
+    * n sub-segments
+    *
+    * @pre     KochGenerator must be initialized with level at most
+    *          getRule().getMaxLevel() and a resolution of 0
+    *
+    * @post    state of this KochGenerator does not change
+    *
+    * @return  number of points in the curve
+    */
+   long long getPointCount() const;
+
+   /**
+    * Retrieves the point at the specified index of the Koch curve, 
+    * where index 0 is the first point. The base 4 digits of the index
+    * (base n for a rule of n sub-segments) select which sub-curve to
+    * descend into on each level, so only O(level) points are 
+    * computed, and tabled curves read the point from their KochTable.
+    * The result is identical to the point generate() produces at 
+    * that index. The resolution is not applied.
+    *
+    * @pre            KochGenerator must be initialized and index must
+    *                 be less than getPointCount()
+    *
+    * @post           state of this KochGenerator does not change
+    * 
+    * @param   index  index of the point in the curve
+    *
+    * @return         point at the index
+    */
+   Point pointAt(long long index) const;
+
+   /**
+    * Hands the points with indices in the half-open range 
+    * [first, last) to the specified PointSink in curve order, 
+    * skipping every sub-curve outside the range. Only addPoint() is 
+    * called on the sink, and the resolution is not applied.
+    *
+    * @pre            KochGenerator must be initialized and 
+    *                 first <= last <= getPointCount()
+    *
+    * @post           state of this KochGenerator does not change
+    * 
+    * @param   first  index of the first point to generate
+    * @param   last   index one past the last point to generate
+    * @param   sink   PointSink receiving the points
+    */
+   void generateRange(long long first, long long last, 
+      PointSink& sink) const;
+
    /**
    * Recursively adds points representing Koch curve
    *
@@ -64,19 +295,121 @@ public:
    */
    void drawKoch(double x1, double y1, double x2, double y2, int level);
 
+   /**
+   * Recursively hands points representing Koch curve to the specified
+   * PointSink in curve order, drawing segments shorter than the 
+   * resolution as straight lines
+   *
+   * @pre            KochGenerator must be initialized
+   *
+   * @post           state of this KochGenerator does not change
+   * 
+   * @param   x1     X coordinate of first point
+   * @param   y1     Y coordinate of first point
+   * @param   x2     X coordinate of second point
+   * @param   y2     Y coordinate of second point
+   * @param   level  Koch level to draw
+   * @param   sink   PointSink receiving the points
+   */
+   void drawKoch(double x1, double y1, double x2, double y2, int level,
+      PointSink& sink) const;
+
 private:
+   /**
+   * Recursively hands the points of a sub-curve whose indices fall in
+   * the half-open range [first, last) to the specified PointSink
+   *
+   * @param   x1      X coordinate of first point
+   * @param   y1      Y coordinate of first point
+   * @param   x2      X coordinate of second point
+   * @param   y2      Y coordinate of second point
+   * @param   level   Koch level to draw
+   * @param   offset  index of the first point of the sub-curve
+   * @param   first   index of the first point to generate
+   * @param   last    index one past the last point to generate
+   * @param   sink    PointSink receiving the points
+   */
+   void drawKochRange(double x1, double y1, double x2, double y2,
+      int level, long long offset, long long first, long long last,
+      PointSink& sink) const;
+
+   /**
+    * Retrieves the point at the specified index of a curve drawn from
+    * its KochTable, mapping the unit curve onto the first and last
+    * points
+    *
+    * @pre            the curve has a KochTable and index must be less
+    *                 than getPointCount()
+    *
+    * @param   index  index of the point in the curve
+    *
+    * @return         point at the index
+    */
+   Point tablePointAt(long long index) const;
+
+   /**
+    * Hands the points of a curve drawn from its KochTable with 
+    * indices in the half-open range [first, last) to the specified
+    * PointSink
+    *
+    * @pre            the curve has a KochTable and 
+    *                 first <= last <= getPointCount()
+    *
+    * @param   first  index of the first point to generate
+    * @param   last   index one past the last point to generate
+    * @param   sink   PointSink receiving the points
+    */
+   void drawTable(long long first, long long last, PointSink& sink) const;
+
+   /**
+    * Generates the points of the whole Koch curve into the specified
+    * PointSink using threadCount threads. The curve is split into 
+    * subtrees whose points are drawn into separate Queues on a 
+    * ThreadPool; each Queue is handed to the sink in curve order as 
+    * soon as it and all Queues before it are complete. At most twice
+    * threadCount subtrees are drawn or waiting at a time.
+    *
+    * @pre            KochGenerator must be initialized
+    *
+    * @post           state of this KochGenerator does not change
+    * 
+    * @param   sink   PointSink receiving the points of the curve
+    */
+   void drawKochParallel(PointSink& sink) const;
+
    /** stores Point objects representing Koch curve */
    Queue<Point> points;
    /** first point inputted into this KochGenerator object */
    Point firstPoint;
+   /** last point inputted into this KochGenerator object */
+   Point lastPoint;
    /** Koch curve level */
    int curveLevel;
+   /** true if points are generated on output instead of stored */
+   bool streaming;
+   /** number of threads drawing the curve */
+   int threadCount;
+   /** shortest segment that is still divided, or 0 */
+   double resolution;
+   /** generator of the curve */
+   GeneratorRule rule;
+   /** true if the rule is the Koch rule, which is split inline */
+   bool koch;
+   /** number of sub-segments of the rule */
+   int segmentCount;
+   /** X coordinates of the KochTable of the curve, or nullptr if it
+       is drawn recursively */
+   const double* tableXCoords;
+   /** Y coordinates of the KochTable of the curve, or nullptr */
+   const double* tableYCoords;
 };
 
 /**
  * Overloads the output stream operator for use with KochGenerator 
  * objects. Allows for outputting the values of this KochGenerator 
- * into the output stream.
+ * into the output stream. Stored points are read in place, so the
+ * KochGenerator is neither copied nor emptied and can be output
+ * again.
  *
  * @pre                    KochGenerator must be initialized
  *
@@ -90,5 +423,5 @@ private:
  * @return                 output stream
  */
 std::ostream& operator<<(std::ostream& output,
-   KochGenerator kochGenerator);
+   const KochGenerator& kochGenerator);
 // end KochGenerator.h
\ No newline at end of file
@@ -0,0 +1,343 @@
+/**
+ * KochKernels.cpp
+ *
+ * Implementations for the kernels that expand one level of a Koch
+ * curve stored as structure-of-arrays vertex coordinates.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include "KochKernels.h"
+#include "Point.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KOCH_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+   /** cosine of the tip rotation, as in Point::kochStep */
+   const double COS_THETA = Point::KOCH_COS;
+   /** sine of the tip rotation, as in Point::kochStep */
+   const double SIN_THETA = Point::KOCH_SIN;
+
+   /**
+    * Expands the segments in [first, segmentCount) one at a time
+    */
+   void expandScalar(const double* xs, const double* ys,
+      long long first, long long segmentCount, double* outXs,
+      double* outYs) {
+
+      for (long long i = first; i < segmentCount; i++) {
+         double x1 = xs[i];
+         double y1 = ys[i];
+         double x2 = xs[i + 1];
+         double y2 = ys[i + 1];
+
+         // section koch curve into thirds
+         double fx = ((2 * x1) + (1 * x2)) / 3;
+         double fy = ((2 * y1) + (1 * y2)) / 3;
+         double sx = ((1 * fx) + (1 * x2)) / 2;
+         double sy = ((1 * fy) + (1 * y2)) / 2;
+
+         // tip of equalaterial triangle in middle
+         double tx = sx + ((fx - sx) * COS_THETA - (fy - sy) * SIN_THETA);
+         double ty = sy + ((fx - sx) * SIN_THETA + (fy - sy) * COS_THETA);
+
+         double* outX = outXs + 4 * i;
+         double* outY = outYs + 4 * i;
+         outX[0] = x1; outX[1] = fx; outX[2] = tx; outX[3] = sx;
+         outY[0] = y1; outY[1] = fy; outY[2] = ty; outY[3] = sy;
+      }
+
+      outXs[4 * segmentCount] = xs[segmentCount];
+      outYs[4 * segmentCount] = ys[segmentCount];
+   }
+
+   /**
+    * Scalar kernel
+    */
+   void kernelScalar(const double* xs, const double* ys,
+      long long segmentCount, double* outXs, double* outYs) {
+      expandScalar(xs, ys, 0, segmentCount, outXs, outYs);
+   }
+
+#ifdef KOCH_KERNELS_X86
+   /**
+    * SSE2 kernel, which expands two segments at a time
+    */
+   __attribute__((target("sse2")))
+   void kernelSse2(const double* xs, const double* ys,
+      long long segmentCount, double* outXs, double* outYs) {
+
+      const __m128d two = _mm_set1_pd(2);
+      const __m128d three = _mm_set1_pd(3);
+      const __m128d cosTheta = _mm_set1_pd(COS_THETA);
+      const __m128d sinTheta = _mm_set1_pd(SIN_THETA);
+
+      long long i = 0;
+      for (; i + 2 <= segmentCount; i += 2) {
+         __m128d x1 = _mm_loadu_pd(xs + i);
+         __m128d y1 = _mm_loadu_pd(ys + i);
+         __m128d x2 = _mm_loadu_pd(xs + i + 1);
+         __m128d y2 = _mm_loadu_pd(ys + i + 1);
+
+         __m128d fx = _mm_div_pd(_mm_add_pd(_mm_mul_pd(two, x1), x2), three);
+         __m128d fy = _mm_div_pd(_mm_add_pd(_mm_mul_pd(two, y1), y2), three);
+         __m128d sx = _mm_div_pd(_mm_add_pd(fx, x2), two);
+         __m128d sy = _mm_div_pd(_mm_add_pd(fy, y2), two);
+
+         __m128d dx = _mm_sub_pd(fx, sx);
+         __m128d dy = _mm_sub_pd(fy, sy);
+         __m128d tx = _mm_add_pd(sx, _mm_sub_pd(_mm_mul_pd(dx, cosTheta),
+            _mm_mul_pd(dy, sinTheta)));
+         __m128d ty = _mm_add_pd(sy, _mm_add_pd(_mm_mul_pd(dx, sinTheta),
+            _mm_mul_pd(dy, cosTheta)));
+
+         // interleave into vertex order: x1 f t s for each segment
+         double* outX = outXs + 4 * i;
+         _mm_storeu_pd(outX, _mm_unpacklo_pd(x1, fx));
+         _mm_storeu_pd(outX + 2, _mm_unpacklo_pd(tx, sx));
+         _mm_storeu_pd(outX + 4, _mm_unpackhi_pd(x1, fx));
+         _mm_storeu_pd(outX + 6, _mm_unpackhi_pd(tx, sx));
+
+         double* outY = outYs + 4 * i;
+         _mm_storeu_pd(outY, _mm_unpacklo_pd(y1, fy));
+         _mm_storeu_pd(outY + 2, _mm_unpacklo_pd(ty, sy));
+         _mm_storeu_pd(outY + 4, _mm_unpackhi_pd(y1, fy));
+         _mm_storeu_pd(outY + 6, _mm_unpackhi_pd(ty, sy));
+      }
+
+      expandScalar(xs, ys, i, segmentCount, outXs, outYs);
+   }
+
+   /**
+    * Transposes four rows of four doubles and stores the columns
+    * consecutively
+    */
+   __attribute__((target("avx2")))
+   inline void storeTransposed(double* output, __m256d row0,
+      __m256d row1, __m256d row2, __m256d row3) {
+
+      __m256d low01 = _mm256_unpacklo_pd(row0, row1);
+      __m256d high01 = _mm256_unpackhi_pd(row0, row1);
+      __m256d low23 = _mm256_unpacklo_pd(row2, row3);
+      __m256d high23 = _mm256_unpackhi_pd(row2, row3);
+
+      _mm256_storeu_pd(output, _mm256_permute2f128_pd(low01, low23, 0x20));
+      _mm256_storeu_pd(output + 4,
+         _mm256_permute2f128_pd(high01, high23, 0x20));
+      _mm256_storeu_pd(output + 8,
+         _mm256_permute2f128_pd(low01, low23, 0x31));
+      _mm256_storeu_pd(output + 12,
+         _mm256_permute2f128_pd(high01, high23, 0x31));
+   }
+
+   /**
+    * AVX2 kernel, which expands four segments at a time
+    */
+   __attribute__((target("avx2")))
+   void kernelAvx2(const double* xs, const double* ys,
+      long long segmentCount, double* outXs, double* outYs) {
+
+      const __m256d two = _mm256_set1_pd(2);
+      const __m256d three = _mm256_set1_pd(3);
+      const __m256d cosTheta = _mm256_set1_pd(COS_THETA);
+      const __m256d sinTheta = _mm256_set1_pd(SIN_THETA);
+
+      long long i = 0;
+      for (; i + 4 <= segmentCount; i += 4) {
+         __m256d x1 = _mm256_loadu_pd(xs + i);
+         __m256d y1 = _mm256_loadu_pd(ys + i);
+         __m256d x2 = _mm256_loadu_pd(xs + i + 1);
+         __m256d y2 = _mm256_loadu_pd(ys + i + 1);
+
+         __m256d fx = _mm256_div_pd(
+            _mm256_add_pd(_mm256_mul_pd(two, x1), x2), three);
+         __m256d fy = _mm256_div_pd(
+            _mm256_add_pd(_mm256_mul_pd(two, y1), y2), three);
+         __m256d sx = _mm256_div_pd(_mm256_add_pd(fx, x2), two);
+         __m256d sy = _mm256_div_pd(_mm256_add_pd(fy, y2), two);
+
+         __m256d dx = _mm256_sub_pd(fx, sx);
+         __m256d dy = _mm256_sub_pd(fy, sy);
+         __m256d tx = _mm256_add_pd(sx, _mm256_sub_pd(
+            _mm256_mul_pd(dx, cosTheta), _mm256_mul_pd(dy, sinTheta)));
+         __m256d ty = _mm256_add_pd(sy, _mm256_add_pd(
+            _mm256_mul_pd(dx, sinTheta), _mm256_mul_pd(dy, cosTheta)));
+
+         // interleave into vertex order: x1 f t s for each segment
+         storeTransposed(outXs + 4 * i, x1, fx, tx, sx);
+         storeTransposed(outYs + 4 * i, y1, fy, ty, sy);
+      }
+
+      expandScalar(xs, ys, i, segmentCount, outXs, outYs);
+   }
+#endif
+
+   /**
+    * Maps the vertices in [first, count) one at a time
+    */
+   void affineScalar(const double* us, const double* vs, long long first,
+      long long count, double xScale, double yScale, double xOffset,
+      double yOffset, double* outXs, double* outYs) {
+
+      for (long long i = first; i < count; i++) {
+         outXs[i] = xOffset + (xScale * us[i] - yScale * vs[i]);
+         outYs[i] = yOffset + (yScale * us[i] + xScale * vs[i]);
+      }
+   }
+
+   /**
+    * Scalar affine kernel
+    */
+   void affineKernelScalar(const double* us, const double* vs,
+      long long count, double xScale, double yScale, double xOffset,
+      double yOffset, double* outXs, double* outYs) {
+      affineScalar(us, vs, 0, count, xScale, yScale, xOffset, yOffset,
+         outXs, outYs);
+   }
+
+#ifdef KOCH_KERNELS_X86
+   /**
+    * SSE2 affine kernel, which maps two vertices at a time
+    */
+   __attribute__((target("sse2")))
+   void affineKernelSse2(const double* us, const double* vs,
+      long long count, double xScale, double yScale, double xOffset,
+      double yOffset, double* outXs, double* outYs) {
+
+      const __m128d a = _mm_set1_pd(xScale);
+      const __m128d b = _mm_set1_pd(yScale);
+      const __m128d tx = _mm_set1_pd(xOffset);
+      const __m128d ty = _mm_set1_pd(yOffset);
+
+      long long i = 0;
+      for (; i + 2 <= count; i += 2) {
+         __m128d u = _mm_loadu_pd(us + i);
+         __m128d v = _mm_loadu_pd(vs + i);
+
+         _mm_storeu_pd(outXs + i, _mm_add_pd(tx, 
+            _mm_sub_pd(_mm_mul_pd(a, u), _mm_mul_pd(b, v))));
+         _mm_storeu_pd(outYs + i, _mm_add_pd(ty, 
+            _mm_add_pd(_mm_mul_pd(b, u), _mm_mul_pd(a, v))));
+      }
+
+      affineScalar(us, vs, i, count, xScale, yScale, xOffset, yOffset,
+         outXs, outYs);
+   }
+
+   /**
+    * AVX2 affine kernel, which maps four vertices at a time. Fused
+    * multiply-add is left out so that it matches the other kernels.
+    */
+   __attribute__((target("avx2")))
+   void affineKernelAvx2(const double* us, const double* vs,
+      long long count, double xScale, double yScale, double xOffset,
+      double yOffset, double* outXs, double* outYs) {
+
+      const __m256d a = _mm256_set1_pd(xScale);
+      const __m256d b = _mm256_set1_pd(yScale);
+      const __m256d tx = _mm256_set1_pd(xOffset);
+      const __m256d ty = _mm256_set1_pd(yOffset);
+
+      long long i = 0;
+      for (; i + 4 <= count; i += 4) {
+         __m256d u = _mm256_loadu_pd(us + i);
+         __m256d v = _mm256_loadu_pd(vs + i);
+
+         _mm256_storeu_pd(outXs + i, _mm256_add_pd(tx, 
+            _mm256_sub_pd(_mm256_mul_pd(a, u), _mm256_mul_pd(b, v))));
+         _mm256_storeu_pd(outYs + i, _mm256_add_pd(ty, 
+            _mm256_add_pd(_mm256_mul_pd(b, u), _mm256_mul_pd(a, v))));
+      }
+
+      affineScalar(us, vs, i, count, xScale, yScale, xOffset, yOffset,
+         outXs, outYs);
+   }
+#endif
+}
+
+/**
+ * Retrieves the kernel with the specified name
+ *
+ * @param   name   "scalar", "sse2" or "avx2"
+ *
+ * @return         the kernel, or nullptr if it is unknown or the
+ *                 processor does not support it
+ */
+KochKernel findKochKernel(const std::string& name) {
+   if (name == "scalar") {
+      return kernelScalar;
+   }
+#ifdef KOCH_KERNELS_X86
+   if (name == "sse2" && __builtin_cpu_supports("sse2")) {
+      return kernelSse2;
+   }
+   if (name == "avx2" && __builtin_cpu_supports("avx2")) {
+      return kernelAvx2;
+   }
+#endif
+   return nullptr;
+}
+
+/**
+ * Retrieves the fastest kernel the processor supports
+ *
+ * @return         the kernel
+ */
+KochKernel bestKochKernel() {
+   static const KochKernel kernel = findKochKernel(bestKochKernelName());
+   return kernel;
+}
+
+/**
+ * Retrieves the name of the fastest kernel the processor supports
+ *
+ * @return         "avx2", "sse2" or "scalar"
+ */
+std::string bestKochKernelName() {
+   const char* names[] = { "avx2", "sse2" };
+
+   for (const char* name : names) {
+      if (findKochKernel(name) != nullptr) {
+         return name;
+      }
+   }
+   return "scalar";
+}
+
+/**
+ * Retrieves the affine kernel with the specified name. All affine
+ * kernels produce identical vertices.
+ *
+ * @param   name   "scalar", "sse2" or "avx2"
+ *
+ * @return         the kernel, or nullptr if it is unknown or the
+ *                 processor does not support it
+ */
+AffineKernel findAffineKernel(const std::string& name) {
+   if (name == "scalar") {
+      return affineKernelScalar;
+   }
+#ifdef KOCH_KERNELS_X86
+   if (name == "sse2" && __builtin_cpu_supports("sse2")) {
+      return affineKernelSse2;
+   }
+   if (name == "avx2" && __builtin_cpu_supports("avx2")) {
+      return affineKernelAvx2;
+   }
+#endif
+   return nullptr;
+}
+
+/**
+ * Retrieves the fastest affine kernel the processor supports
+ *
+ * @return         the kernel
+ */
+AffineKernel bestAffineKernel() {
+   static const AffineKernel kernel = 
+      findAffineKernel(bestKochKernelName());
+   return kernel;
+} // end KochKernels.cpp
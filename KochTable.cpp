@@ -0,0 +1,61 @@
+/**
+ * KochTable.cpp
+ *
+ * Definitions of the Koch curve tables of levels 0 to 
+ * MAX_TABLE_LEVEL, which are evaluated by the compiler.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include "KochTable.h"
+
+namespace {
+   constexpr KochTable<0> TABLE_0;
+   constexpr KochTable<1> TABLE_1;
+   constexpr KochTable<2> TABLE_2;
+   constexpr KochTable<3> TABLE_3;
+   constexpr KochTable<4> TABLE_4;
+   constexpr KochTable<5> TABLE_5;
+   constexpr KochTable<6> TABLE_6;
+
+   static_assert(MAX_TABLE_LEVEL == 6, "a table is missing");
+   static_assert(TABLE_6.VERTEX_COUNT == (1 << 12) + 1,
+      "a level 6 curve has 4^6 segments");
+   static_assert(TABLE_1.us[2] > 0.4999 && TABLE_1.us[2] < 0.5001 &&
+      TABLE_1.vs[2] > 0.288 && TABLE_1.vs[2] < 0.289, 
+      "the tip of a unit Koch step");
+
+   /** X coordinates of the tables by level */
+   constexpr const double* X_COORDS[] = { TABLE_0.us, TABLE_1.us, 
+      TABLE_2.us, TABLE_3.us, TABLE_4.us, TABLE_5.us, TABLE_6.us };
+   /** Y coordinates of the tables by level */
+   constexpr const double* Y_COORDS[] = { TABLE_0.vs, TABLE_1.vs, 
+      TABLE_2.vs, TABLE_3.vs, TABLE_4.vs, TABLE_5.vs, TABLE_6.vs };
+}
+
+/**
+ * Retrieves the X coordinates of the table of a level
+ *
+ * @pre            0 <= level <= MAX_TABLE_LEVEL
+ *
+ * @param   level  Koch level of the table
+ *
+ * @return         4^level + 1 X coordinates
+ */
+const double* kochTableXCoords(int level) {
+   return X_COORDS[level];
+}
+
+/**
+ * Retrieves the Y coordinates of the table of a level
+ *
+ * @pre            0 <= level <= MAX_TABLE_LEVEL
+ *
+ * @param   level  Koch level of the table
+ *
+ * @return         4^level + 1 Y coordinates
+ */
+const double* kochTableYCoords(int level) {
+   return Y_COORDS[level];
+}
+// end KochTable.cpp
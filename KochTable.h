@@ -0,0 +1,110 @@
+/**
+ * KochTable.h
+ *
+ * Declarations for the Koch curve tables, the unit Koch curves from
+ * (0,0) to (1,0) of levels 0 to MAX_TABLE_LEVEL. The tables are 
+ * computed by the compiler and stored as static arrays, so a curve of
+ * a small level is drawn by mapping a table onto its segment with one
+ * affine transform, without recursion, trigonometry or allocation.
+ *
+ * Every table is the table of the level below with each segment split
+ * by the same arithmetic as Point::kochStep, so its vertices are 
+ * exactly those KochGenerator::drawKoch produces for the unit 
+ * segment. Vertices mapped onto another segment agree with drawKoch
+ * within 1e-12 of the segment length.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include "Point.h"
+
+/** highest level with a Koch curve table */
+const int MAX_TABLE_LEVEL = 6;
+
+/**
+ * Represents the unit Koch curve of one level, computed at compile
+ * time
+ */
+template <int Level>
+struct KochTable {
+   /** number of vertices, 4^Level + 1 */
+   static constexpr int VERTEX_COUNT = 
+      4 * KochTable<Level - 1>::VERTEX_COUNT - 3;
+
+   /** X coordinates of the vertices */
+   double us[VERTEX_COUNT];
+   /** Y coordinates of the vertices */
+   double vs[VERTEX_COUNT];
+
+   /**
+    * Constructor for KochTable class, which splits every segment of 
+    * the table of the level below into a Koch step
+    */
+   constexpr KochTable() : us(), vs() {
+      const KochTable<Level - 1> prior;
+
+      for (int i = 0; i + 1 < prior.VERTEX_COUNT; i++) {
+         double x1 = prior.us[i];
+         double y1 = prior.vs[i];
+         double x2 = prior.us[i + 1];
+         double y2 = prior.vs[i + 1];
+
+         // same arithmetic as Point::kochStep
+         double fx = (2 * x1 + x2) / 3;
+         double fy = (2 * y1 + y2) / 3;
+         double sx = (fx + x2) / 2;
+         double sy = (fy + y2) / 2;
+         double dx = fx - sx;
+         double dy = fy - sy;
+
+         us[4 * i] = x1;
+         vs[4 * i] = y1;
+         us[4 * i + 1] = fx;
+         vs[4 * i + 1] = fy;
+         us[4 * i + 2] = sx + (dx * Point::KOCH_COS - dy * Point::KOCH_SIN);
+         vs[4 * i + 2] = sy + (dx * Point::KOCH_SIN + dy * Point::KOCH_COS);
+         us[4 * i + 3] = sx;
+         vs[4 * i + 3] = sy;
+      }
+      us[VERTEX_COUNT - 1] = 1;
+      vs[VERTEX_COUNT - 1] = 0;
+   }
+};
+
+/**
+ * Represents the unit Koch curve of level 0, the unit segment
+ */
+template <>
+struct KochTable<0> {
+   /** number of vertices */
+   static constexpr int VERTEX_COUNT = 2;
+
+   /** X coordinates of the vertices */
+   double us[VERTEX_COUNT] = { 0, 1 };
+   /** Y coordinates of the vertices */
+   double vs[VERTEX_COUNT] = { 0, 0 };
+};
+
+/**
+ * Retrieves the X coordinates of the table of a level
+ *
+ * @pre            0 <= level <= MAX_TABLE_LEVEL
+ *
+ * @param   level  Koch level of the table
+ *
+ * @return         4^level + 1 X coordinates
+ */
+const double* kochTableXCoords(int level);
+
+/**
+ * Retrieves the Y coordinates of the table of a level
+ *
+ * @pre            0 <= level <= MAX_TABLE_LEVEL
+ *
+ * @param   level  Koch level of the table
+ *
+ * @return         4^level + 1 Y coordinates
+ */
+const double* kochTableYCoords(int level);
+// end KochTable.h
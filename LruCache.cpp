@@ -0,0 +1,109 @@
+/**
+ * LruCache.cpp
+ *
+ * Implementations for the LruCache class, which keeps recently
+ * produced outputs up to a total size in bytes.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include "LruCache.h"
+
+/**
+ * Constructor for LruCache class
+ *
+ * @param   capacity   largest total size of the keys and outputs
+ *                     in bytes
+ */
+LruCache::LruCache(std::size_t capacity) : capacity(capacity), size(0) {}
+
+/**
+ * Retrieves the output stored under a key and marks it as the
+ * most recently used
+ *
+ * @param   key     key of the output
+ *
+ * @return          the output, or nullptr if it is not cached
+ */
+std::shared_ptr<const std::string> LruCache::find(const std::string& key) {
+   std::lock_guard<std::mutex> guard(lock);
+
+   auto found = index.find(key);
+   if (found == index.end()) {
+      return nullptr;
+   }
+
+   entries.splice(entries.begin(), entries, found->second);
+   return found->second->second;
+}
+
+/**
+ * Stores an output under a key as the most recently used, evicting
+ * the least recently used outputs until it fits. Outputs larger
+ * than the capacity are not stored.
+ *
+ * @param   key      key of the output
+ * @param   output   output to store
+ */
+void LruCache::insert(const std::string& key,
+   std::shared_ptr<const std::string> output) {
+
+   std::size_t entrySize = key.size() + output->size();
+   std::lock_guard<std::mutex> guard(lock);
+
+   auto found = index.find(key);
+   if (found != index.end()) {
+      size -= found->first.size() + found->second->second->size();
+      entries.erase(found->second);
+      index.erase(found);
+   }
+   if (entrySize > capacity) {
+      return;
+   }
+
+   while (size + entrySize > capacity) {
+      evict();
+   }
+   entries.emplace_front(key, std::move(output));
+   index[key] = entries.begin();
+   size += entrySize;
+}
+
+/**
+ * Retrieves the largest total size of the cache
+ *
+ * @return  capacity in bytes
+ */
+std::size_t LruCache::getCapacity() const {
+   return capacity;
+}
+
+/**
+ * Retrieves the total size of the keys and outputs stored
+ *
+ * @return  size in bytes
+ */
+std::size_t LruCache::getSize() const {
+   std::lock_guard<std::mutex> guard(lock);
+   return size;
+}
+
+/**
+ * Retrieves the number of outputs stored
+ *
+ * @return  number of outputs
+ */
+std::size_t LruCache::getEntryCount() const {
+   std::lock_guard<std::mutex> guard(lock);
+   return entries.size();
+}
+
+/**
+ * Removes the least recently used entry
+ */
+void LruCache::evict() {
+   const Entry& last = entries.back();
+   size -= last.first.size() + last.second->size();
+   index.erase(last.first);
+   entries.pop_back();
+} // end LruCache.cpp
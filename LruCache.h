@@ -0,0 +1,99 @@
+/**
+ * LruCache.h
+ *
+ * Declarations for the LruCache class, which keeps recently produced
+ * outputs under string keys up to a total size in bytes and evicts
+ * the least recently used output first when full. It may be shared
+ * by several threads.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * Represents a size-bounded least recently used cache of outputs
+ */
+class LruCache {
+public:
+   /**
+    * Constructor for LruCache class
+    *
+    * @param   capacity   largest total size of the keys and outputs
+    *                     in bytes
+    */
+   explicit LruCache(std::size_t capacity);
+
+   LruCache(const LruCache&) = delete;
+   LruCache& operator=(const LruCache&) = delete;
+
+   /**
+    * Retrieves the output stored under a key and marks it as the
+    * most recently used
+    *
+    * @param   key     key of the output
+    *
+    * @return          the output, or nullptr if it is not cached
+    */
+   std::shared_ptr<const std::string> find(const std::string& key);
+
+   /**
+    * Stores an output under a key as the most recently used, evicting
+    * the least recently used outputs until it fits. Outputs larger
+    * than the capacity are not stored.
+    *
+    * @param   key      key of the output
+    * @param   output   output to store
+    */
+   void insert(const std::string& key,
+      std::shared_ptr<const std::string> output);
+
+   /**
+    * Retrieves the largest total size of the cache
+    *
+    * @return  capacity in bytes
+    */
+   std::size_t getCapacity() const;
+
+   /**
+    * Retrieves the total size of the keys and outputs stored
+    *
+    * @return  size in bytes
+    */
+   std::size_t getSize() const;
+
+   /**
+    * Retrieves the number of outputs stored
+    *
+    * @return  number of outputs
+    */
+   std::size_t getEntryCount() const;
+
+private:
+   /** key and output of one entry */
+   typedef std::pair<std::string, std::shared_ptr<const std::string> >
+      Entry;
+
+   /**
+    * Removes the least recently used entry
+    */
+   void evict();
+
+   /** largest total size of the keys and outputs */
+   std::size_t capacity;
+   /** total size of the keys and outputs */
+   std::size_t size;
+   /** entries from most to least recently used */
+   std::list<Entry> entries;
+   /** position of every key in entries */
+   std::unordered_map<std::string, std::list<Entry>::iterator> index;
+   /** guards all members */
+   mutable std::mutex lock;
+}; // end LruCache.h
@@ -12,14 +12,320 @@
 #include "Queue.h"
 #include "Point.h"
 #include <cmath>
+#include <sstream>
 #include <string>
+#include <vector>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <csignal>
+#include <pthread.h>
+#include <unistd.h>
+#include "Batch.h"
+#include "BinaryCurve.h"
+#include "BreadthFirstGenerator.h"
+#include "CompactingSink.h"
+#include "CurveServer.h"
+#include "CurveWriter.h"
+#include "GeneratorRule.h"
 #include "KochGenerator.h"
+#include "PolygonGenerator.h"
+#include "PostScriptWriter.h"
+#include "PrecisionGenerator.h"
+#include "Rasterizer.h"
+#include "Shard.h"
+#include "TemplateCache.h"
+
+/**
+ * Reads the vertices of a comma separated list of coordinates
+ *
+ * @param   list        coordinates x,y,x,y,...
+ *
+ * @return              vertices in list order
+ *
+ * @throw   std::invalid_argument if the list is not pairs of numbers
+ */
+std::vector<Point> parseVertices(const std::string& list) {
+   std::vector<Point> vertices;
+   std::istringstream coordinates(list);
+   double xCoord, yCoord;
+   char separator;
+
+   while (coordinates >> xCoord >> separator >> yCoord) {
+      vertices.push_back(Point(xCoord, yCoord));
+
+      if (!(coordinates >> separator)) {
+         return vertices;
+      }
+   }
+   throw std::invalid_argument("Vertices must be x,y,x,y,...");
+}
+
+/**
+ * Draws a Koch curve with coordinates of type Coord and writes its
+ * points in double coordinates
+ *
+ * @param   x1          X coordinate of first point
+ * @param   y1          Y coordinate of first point
+ * @param   x2          X coordinate of second point
+ * @param   y2          Y coordinate of second point
+ * @param   level       Koch level to draw
+ * @param   writer      PointSink writing the curve
+ *
+ * @throw   std::invalid_argument if the curve does not fit in 
+ *          coordinates of type Coord
+ */
+template <typename Coord>
+void drawPrecise(double x1, double y1, double x2, double y2, int level,
+   PointSink& writer) {
+   PrecisionGenerator<Coord> generator(x1, y1, x2, y2, level, true);
+   ConvertingSink<Coord> sink(writer);
+   generator.generate(sink);
+}
+
+/**
+ * Serves requests until the process receives SIGINT or SIGTERM, so
+ * that the server shuts down cleanly and removes its socket
+ *
+ * @param   server   server to run
+ * @param   signals  SIGINT and SIGTERM, already blocked on every
+ *                   thread of the process
+ */
+void serveUntilSignalled(CurveServer& server, const sigset_t& signals) {
+   std::thread waiter([&server, &signals] {
+      int signal;
+      sigwait(&signals, &signal);
+      server.stop();
+   });
+
+   try {
+      server.serve();
+   }
+   catch (...) {
+      // release the waiter before giving up
+      kill(getpid(), SIGTERM);
+      waiter.join();
+      throw;
+   }
+   waiter.join();
+}
 
 /**
  * Entry point for program for generating Koch curve in .ps file 
  * format
+ *
+ * Usage: koch x1 y1 x2 y2 level [--stream] [--threads N] 
+ *             [--shard i/N] [--simd] [--format F] 
+ *             [--output F:path]... [--dpi N] [--resolution T] 
+ *             [--compact] [--template] [--template-dir D] 
+ *             [--table] [--precision P] [--rule R] [--snowflake | 
+ *             --polygon x,y,... | --polyline x,y,...]
+ *        koch --merge shard...
+ *        koch --to-ps curve
+ *        koch --batch [jobs] [--threads N] [--template] 
+ *             [--template-dir D]
+ *        koch --serve address [--threads N] [--cache-size MB] 
+ *             [--template] [--template-dir D]
+ *        koch --client address x1 y1 x2 y2 level [format]
+ *
+ *    --stream       write each point as it is generated instead of
+ *                   storing the whole curve first
+ *    --threads N    draw the curve on N threads; the output is 
+ *                   identical to that of a single thread
+ *    --shard i/N    write only the i-th of N slices of the curve, 
+ *                   to be combined with --merge
+ *    --simd         generate the curve breadth first with SIMD 
+ *                   kernels on a single thread
+ *    --format F     write the curve as ps (default), svg, pdf, as 
+ *                   binary rounded deltas (binary) or as binary 
+ *                   float32 or float64 coordinates (binary32, 
+ *                   binary64), or draw it as a pgm or png image; 
+ *                   binary32 rounds coordinates to floats, so only
+ *                   binary and binary64 convert back to the same .ps
+ *    --output F:path  write the curve in format F to a file instead
+ *                   of standard output; may be repeated to write 
+ *                   several files from one generated curve; not 
+ *                   available for images
+ *    --dpi N        resolution of pgm and png images, 72 by default
+ *    --resolution T stop dividing segments shorter than T points and
+ *                   draw them straight; images always stop at a 
+ *                   pixel
+ *    --compact      snap points to integer positions, drop moves that
+ *                   stay in place and merge moves in one direction
+ *    --template     draw every segment by mapping a cached unit curve
+ *                   of its level, which may round a few points 
+ *                   differently from the recursive curve
+ *    --template-dir D  use --template, keeping the unit curves as
+ *                   files in directory D that later runs map from 
+ *                   disk instead of generating
+ *    --table        draw curves of levels up to 6 by mapping a unit
+ *                   curve the compiler built, which may round a few 
+ *                   points differently from the recursive curve
+ *    --precision P  compute the curve in float, double (default) or
+ *                   fixed-point coordinates; see PrecisionGenerator.h
+ *    --rule R       draw the curve of generator rule R instead of 
+ *                   the Koch curve: quadratic, cesaro:ANGLE, levy, 
+ *                   minkowski or a table scale:rotation,...; see
+ *                   GeneratorRule.h
+ *    --snowflake    draw a closed Koch snowflake on the segment
+ *    --polygon L    draw a closed polygon through the segment and 
+ *                   the further vertices in list L
+ *    --polyline L   draw an open polyline through the segment and 
+ *                   the further vertices in list L
+ *    --merge        combine the shards of one curve into a .ps file
+ *    --to-ps        convert a binary curve into a .ps file, which is
+ *                   the original .ps unless the curve is binary32
+ *    --batch        draw every curve of a job list, read from the 
+ *                   file jobs or standard input, on N threads and 
+ *                   report the status of each job; see Batch.h
+ *    --serve        draw curves for clients connecting to address,
+ *                   unix:<path> or tcp:<port>, serving N clients at
+ *                   a time and keeping up to MB megabytes (64 by
+ *                   default) of recent curves; see CurveServer.h
+ *    --client       request a curve from a server and write it to
+ *                   standard output
  */
 int main(int argc, char** argv) {
+   // output is written in large blocks, so skip syncing with stdio
+   std::ios::sync_with_stdio(false);
+
+   if (argc >= 2 && std::string(argv[1]) == "--merge") {
+      std::vector<std::string> paths(argv + 2, argv + argc);
+      mergeShards(paths, std::cout);
+      return EXIT_SUCCESS;
+   }
+
+   if (argc == 3 && std::string(argv[1]) == "--to-ps") {
+      std::ifstream input(argv[2], std::ios::binary);
+      if (!input) {
+         throw std::runtime_error(std::string("Cannot read ") + argv[2]);
+      }
+
+      BinaryCurveReader reader(input);
+      PostScriptWriter writer(std::cout);
+      reader.read(writer);
+      return EXIT_SUCCESS;
+   }
+
+   if (argc >= 8 && std::string(argv[1]) == "--client") {
+      std::string request = argv[3];
+      for (int i = 4; i < argc; i++) {
+         request += ' ';
+         request += argv[i];
+      }
+
+      // a refused request is the server's answer, not a crash
+      try {
+         requestCurve(argv[2], request, std::cout);
+      }
+      catch (const std::exception& error) {
+         std::cerr << error.what() << std::endl;
+         return EXIT_FAILURE;
+      }
+      return EXIT_SUCCESS;
+   }
+
+   if (argc >= 2 && (std::string(argv[1]) == "--batch" ||
+      std::string(argv[1]) == "--serve")) {
+      bool serving = std::string(argv[1]) == "--serve";
+      // path of the job list, or the address to serve on
+      std::string location;
+      int threadCount = 1;
+      std::size_t cacheMegabytes = 64;
+      bool useTemplates = false;
+      std::string templateDirectory;
+
+      for (int i = 2; i < argc; i++) {
+         std::string option = argv[i];
+
+         if (option == "--threads" && i + 1 < argc) {
+            threadCount = atoi(argv[++i]);
+
+            if (threadCount < 1) {
+               throw std::invalid_argument("Thread count must be at least 1");
+            }
+         }
+         else if (option == "--cache-size" && serving && i + 1 < argc) {
+            cacheMegabytes = atol(argv[++i]);
+         }
+         else if (option == "--template") {
+            useTemplates = true;
+         }
+         else if (option == "--template-dir" && i + 1 < argc) {
+            useTemplates = true;
+            templateDirectory = argv[++i];
+         }
+         else if (location.empty() && option.compare(0, 2, "--") != 0) {
+            location = option;
+         }
+         else {
+            throw std::invalid_argument("Unknown option " + option);
+         }
+      }
+
+      // every job shares the pool and the unit curve templates
+      TemplateCache templates(bestKochKernelName(), templateDirectory);
+      TemplateCache* sharedTemplates = 
+         useTemplates ? &templates : nullptr;
+      int failures;
+
+      if (serving) {
+         if (location.empty()) {
+            throw std::invalid_argument("--serve needs an address");
+         }
+
+         // signals are taken by one waiting thread, so block them
+         // before the server starts its pool
+         sigset_t signals;
+         sigemptyset(&signals);
+         sigaddset(&signals, SIGINT);
+         sigaddset(&signals, SIGTERM);
+         pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+         CurveServer server(location, threadCount, 
+            cacheMegabytes << 20, sharedTemplates);
+         std::cerr << "Serving on " << server.getAddress() << std::endl;
+         serveUntilSignalled(server, signals);
+         return EXIT_SUCCESS;
+      }
+
+      if (location.empty()) {
+         failures = runBatch(std::cin, std::cout, threadCount, 
+            sharedTemplates);
+      }
+      else {
+         std::ifstream jobs(location);
+         if (!jobs) {
+            throw std::runtime_error("Cannot read " + location);
+         }
+         failures = runBatch(jobs, std::cout, threadCount, 
+            sharedTemplates);
+      }
+      return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+   }
+
+   if (argc < 6) {
+      std::cerr << "Usage: " << argv[0] << 
+         " x1 y1 x2 y2 level [--stream] [--threads N] [--shard i/N]" <<
+         " [--simd] [--format F] [--output F:path]... [--dpi N]" <<
+         " [--resolution T] [--compact] [--template]" <<
+         " [--template-dir D] [--table] [--precision P] [--rule R]" <<
+         " [--snowflake | --polygon x,y,... | --polyline x,y,...]" <<
+         std::endl;
+      std::cerr << "       " << argv[0] << " --merge shard..." <<
+         std::endl;
+      std::cerr << "       " << argv[0] << " --to-ps curve" << std::endl;
+      std::cerr << "       " << argv[0] << " --batch [jobs]" <<
+         " [--threads N] [--template] [--template-dir D]" << std::endl;
+      std::cerr << "       " << argv[0] << " --serve address" <<
+         " [--threads N] [--cache-size MB] [--template]" <<
+         " [--template-dir D]" << std::endl;
+      std::cerr << "       " << argv[0] << 
+         " --client address x1 y1 x2 y2 level [format]" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+
    // pass in command line arguements
    int x1 = atoi(argv[1]);
    int y1 = atoi(argv[2]);
@@ -31,8 +337,295 @@ int main(int argc, char** argv) {
       throw std::invalid_argument("Koch curve level must be greater or equal than 0");
    }
 
+   // pass in optional arguments
+   bool streaming = false;
+   int threadCount = 1;
+   int shardIndex = -1;
+   int shardCount = 0;
+   bool simd = false;
+   std::string format = "ps";
+   std::vector<std::string> outputs;
+   int dotsPerInch = 72;
+   double resolution = 0;
+   bool compact = false;
+   bool useTemplates = false;
+   std::string templateDirectory;
+   bool tabled = false;
+   std::string precision = "double";
+   std::vector<Point> vertices;
+   bool closed = false;
+   GeneratorRule rule;
+
+   for (int i = 6; i < argc; i++) {
+      std::string option = argv[i];
+
+      if (option == "--stream") {
+         streaming = true;
+      }
+      else if (option == "--threads" && i + 1 < argc) {
+         threadCount = atoi(argv[++i]);
+
+         if (threadCount < 1) {
+            throw std::invalid_argument("Thread count must be at least 1");
+         }
+      }
+      else if (option == "--shard" && i + 1 < argc) {
+         char separator = 0;
+         std::istringstream shard(argv[++i]);
+
+         if (!(shard >> shardIndex >> separator >> shardCount) ||
+            separator != '/' || shardIndex < 0 || 
+            shardIndex >= shardCount) {
+            throw std::invalid_argument("Shard must be i/N with 0 <= i < N");
+         }
+      }
+      else if (option == "--simd") {
+         simd = true;
+      }
+      else if (option == "--format" && i + 1 < argc) {
+         format = argv[++i];
+      }
+      else if (option == "--output" && i + 1 < argc) {
+         outputs.push_back(argv[++i]);
+      }
+      else if (option == "--dpi" && i + 1 < argc) {
+         dotsPerInch = atoi(argv[++i]);
+      }
+      else if (option == "--resolution" && i + 1 < argc) {
+         resolution = atof(argv[++i]);
+
+         if (!(resolution >= 0)) {
+            throw std::invalid_argument("Resolution must not be negative");
+         }
+      }
+      else if (option == "--compact") {
+         compact = true;
+      }
+      else if (option == "--template") {
+         useTemplates = true;
+      }
+      else if (option == "--template-dir" && i + 1 < argc) {
+         useTemplates = true;
+         templateDirectory = argv[++i];
+      }
+      else if (option == "--table") {
+         tabled = true;
+      }
+      else if (option == "--precision" && i + 1 < argc) {
+         precision = argv[++i];
+
+         if (precision != "float" && precision != "double" && 
+            precision != "fixed") {
+            throw std::invalid_argument("Precision must be float, double or "
+               "fixed");
+         }
+      }
+      else if (option == "--rule" && i + 1 < argc) {
+         rule = GeneratorRule::named(argv[++i]);
+      }
+      else if (option == "--snowflake") {
+         vertices = PolygonGenerator::snowflake(Point(x1, y1), 
+            Point(x2, y2));
+         closed = true;
+      }
+      else if ((option == "--polygon" || option == "--polyline") && 
+         i + 1 < argc) {
+         vertices = parseVertices(argv[++i]);
+         vertices.insert(vertices.begin(), { Point(x1, y1), 
+            Point(x2, y2) });
+         closed = option == "--polygon";
+      }
+      else {
+         throw std::invalid_argument("Unknown option " + option);
+      }
+   }
+
+   if (format == "pgm" || format == "png") {
+      if (simd || shardCount > 0 || !outputs.empty() || compact ||
+         useTemplates || tabled || precision != "double" || 
+         !vertices.empty() || !rule.isKoch()) {
+         throw std::invalid_argument("Images cannot be drawn with --simd, "
+            "--shard, --output, --compact, --template, --table, --precision, "
+            "--rule or polygons");
+      }
+
+      // images are drawn straight from the curve, band by band
+      KochGenerator generator(x1, y1, x2, y2, curveLevel,
+         KochOptions::streamed());
+      Rasterizer image(generator, dotsPerInch, threadCount);
+
+      if (format == "pgm") {
+         image.writePgm(std::cout);
+      }
+      else {
+         image.writePng(std::cout);
+      }
+      return EXIT_SUCCESS;
+   }
+
+   if (resolution > 0 && (simd || shardCount > 0)) {
+      throw std::invalid_argument("--resolution cannot be combined with --simd "
+         "or --shard");
+   }
+   if (compact && shardCount > 0) {
+      throw std::invalid_argument("--compact cannot be combined with --shard");
+   }
+   if (!rule.isKoch() && (simd || useTemplates || !vertices.empty())) {
+      throw std::invalid_argument("--rule cannot be combined with --simd, "
+         "--template or polygons");
+   }
+   if (curveLevel > rule.getMaxLevel()) {
+      throw std::invalid_argument("Level is too high for rule " + 
+         rule.getName());
+   }
+   if (useTemplates && (simd || shardCount > 0 || resolution > 0)) {
+      throw std::invalid_argument("--template cannot be combined with --simd, "
+         "--shard or --resolution");
+   }
+   if (tabled && (simd || shardCount > 0 || resolution > 0 || 
+      useTemplates || !rule.isKoch() || !vertices.empty())) {
+      throw std::invalid_argument("--table cannot be combined with --simd, "
+         "--shard, --resolution, --template, --rule or polygons");
+   }
+   if (precision != "double" && (threadCount > 1 || simd || 
+      shardCount > 0 || resolution > 0 || useTemplates || tabled || 
+      !rule.isKoch() || !vertices.empty())) {
+      throw std::invalid_argument("--precision cannot be combined with "
+         "--threads, --simd, --shard, --resolution, --template, --table, "
+         "--rule or polygons");
+   }
+   if (!vertices.empty() && (simd || shardCount > 0)) {
+      throw std::invalid_argument("Polygons cannot be combined with --simd or "
+         "--shard");
+   }
+
+   // a polygon is drawn as one path of Koch curves on its sides
+   TemplateCache templates(bestKochKernelName(), templateDirectory);
+   std::unique_ptr<PolygonGenerator> polygon;
+   Point lastPoint(x2, y2);
+   std::uint64_t sideCount = 1;
+   if (!vertices.empty() && useTemplates) {
+      polygon.reset(new PolygonGenerator(vertices, closed, curveLevel,
+         threadCount, templates));
+      lastPoint = polygon->getLastPoint();
+      sideCount = polygon->getSideCount();
+   }
+   else if (!vertices.empty()) {
+      polygon.reset(new PolygonGenerator(vertices, closed, curveLevel,
+         threadCount, resolution));
+      lastPoint = polygon->getLastPoint();
+      sideCount = polygon->getSideCount();
+   }
+
+   // the number of points is only known when every segment is drawn
+   std::uint64_t pointCount = resolution > 0 || compact ? 
+      UNKNOWN_POINT_COUNT : 
+      sideCount * rule.countSegments(curveLevel) + (closed ? 0 : 1);
+   std::unique_ptr<PointSink> writer;
+
+   // files and their writers must outlive the tee writing to them
+   std::vector<std::unique_ptr<std::ofstream>> files;
+   std::vector<std::unique_ptr<PointSink>> fileWriters;
+
+   if (outputs.empty()) {
+      writer = createWriter(format, std::cout, lastPoint, pointCount, 
+         closed);
+   }
+   else {
+      std::vector<PointSink*> sinks;
+
+      for (const std::string& output : outputs) {
+         std::size_t separator = output.find(':');
+         if (separator == std::string::npos) {
+            throw std::invalid_argument("Output must be F:path");
+         }
+
+         std::string path = output.substr(separator + 1);
+         files.emplace_back(new std::ofstream(path, std::ios::binary));
+         if (!*files.back()) {
+            throw std::runtime_error("Cannot write " + path);
+         }
+
+         fileWriters.push_back(createWriter(output.substr(0, separator),
+            *files.back(), lastPoint, pointCount, closed));
+         sinks.push_back(fileWriters.back().get());
+      }
+      writer.reset(new TeeSink(sinks));
+      format = "tee";
+   }
+
+   // the compacting stage sits in front of every writer
+   if (compact) {
+      fileWriters.push_back(std::move(writer));
+      writer.reset(new CompactingSink(*fileWriters.back()));
+   }
+
+   // narrow coordinates are widened again on their way to the writers
+   if (precision == "float") {
+      drawPrecise<float>(x1, y1, x2, y2, curveLevel, *writer);
+      return EXIT_SUCCESS;
+   }
+   if (precision == "fixed") {
+      drawPrecise<FixedPoint>(x1, y1, x2, y2, curveLevel, *writer);
+      return EXIT_SUCCESS;
+   }
+
+   if (polygon) {
+      polygon->generate(*writer);
+      return EXIT_SUCCESS;
+   }
+
+   if (useTemplates) {
+      // one segment is a single instance of the unit curve
+      writer->begin(Point(x1, y1), curveLevel);
+      templates.drawKoch(Point(x1, y1), Point(x2, y2), curveLevel, 
+         *writer);
+      writer->end();
+      return EXIT_SUCCESS;
+   }
+
+   if (simd) {
+      if (threadCount > 1 || shardCount > 0) {
+         throw std::invalid_argument("--simd runs on a single thread and "
+            "cannot be sharded");
+      }
+
+      // SIMD generation always streams its points
+      BreadthFirstGenerator generator(x1, y1, x2, y2, curveLevel);
+      generator.generate(*writer);
+      return EXIT_SUCCESS;
+   }
+
+   KochOptions options;
+   options.streaming = streaming;
+   options.threadCount = threadCount;
+   options.resolution = resolution;
+   options.rule = rule;
+   options.tabled = tabled;
+
+   if (shardCount > 0) {
+      if (format != "ps") {
+         throw std::invalid_argument("Shards are always written as ps");
+      }
+
+      // a shard generates only its own slice of the curve
+      options.streaming = true;
+      options.threadCount = 1;
+      KochGenerator generator(x1, y1, x2, y2, curveLevel, options);
+      writeShard(generator, shardIndex, shardCount, std::cout);
+      return EXIT_SUCCESS;
+   }
+
+   if (format != "ps" || compact) {
+      // other formats are written as the points are generated
+      options.streaming = true;
+      KochGenerator generator(x1, y1, x2, y2, curveLevel, options);
+      generator.generate(*writer);
+      return EXIT_SUCCESS;
+   }
+
    // create Koch curve
-   KochGenerator generator(x1, y1, x2, y2, curveLevel);
+   KochGenerator generator(x1, y1, x2, y2, curveLevel, options);
    
    // output Koch curve points in .ps file format
    std::cout << generator;
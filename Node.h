@@ -1,16 +1,19 @@
 /**
  * Node.h
  *
- * Declarations for the Node class, which stores a reference to the
- * next Node and a value. These compose a Queue ADT.
+ * Declarations and implementations for the Node class, which stores 
+ * a reference to the next Node and a value. These compose linked 
+ * lists; many Nodes can be drawn from a MonotonicArena through an 
+ * ArenaAllocator<Node<T> > and released together.
  *
  * Joshua Scheck
  * 2020-11-20
  */
 #pragma once
+#include <utility>
 
 /**
- * Represents a Node in a Queue ADT
+ * Represents a Node in a linked list
  */
 template<class T>
 class Node {
@@ -38,6 +41,15 @@ public:
     */
    Node(const T& anEntry, Node<T>* nextNode);
 
+   /**
+    * Constructor for Node class, which initializes a Node by moving
+    * the specified value, with an optional reference to the next Node
+    * 
+    * @param   anEntry  value to be moved into this Node
+    * @param   nextNode reference to the next Node 
+    */
+   Node(T&& anEntry, Node<T>* nextNode = nullptr);
+
    /**
     * Assigns the value to be stored in this Node
     *
@@ -50,6 +62,18 @@ public:
     */
    void setItem(const T& anEntry);
 
+   /**
+    * Moves the value to be stored into this Node
+    *
+    * @pre              Node must be initialized
+    *
+    * @post             new stored value will be assigned to this 
+    *                   Node
+    * 
+    * @param   anEntry  value to be moved into this Node
+    */
+   void setItem(T&& anEntry);
+
    /**
     * Assigns the memory address to the next Node for this Node
     *
@@ -69,9 +93,10 @@ public:
     *
     * @post    state of this Node does not change
     *
-    * @return  value stored in this Node
+    * @return  reference to the value stored in this Node
     */
-   T getItem() const;
+   T& getItem();
+   const T& getItem() const;
 
    /**
     * Retrieves the reference in memory to the next Node for this 
@@ -89,4 +114,132 @@ private:
    T item;
    /** reference in memory to the next Node in the Queue */
    Node<T>* next;
-}; // end Node.h
\ No newline at end of file
+};
+
+/**
+ * Default constructor for Node class, which initializes an empty
+ * Node
+ */
+template<class T>
+Node<T>::Node() : next(nullptr) {}
+
+/**
+ * Constructor for Node class, which initializes a Node with the
+ * specified value, but has no next Node reference
+ * 
+ * @param   anEntry  value to be stored in this Node
+ */
+template<class T>
+Node<T>::Node(const T& anEntry) : 
+   item(anEntry), next(nullptr) {}
+
+/**
+ * Constructor for Node class, which initializes a Node with the
+ * specified value and reference to the next Node
+ * 
+ * @param   anEntry  value to be stored in this Node
+ * @param   nextNode reference to the next Node 
+ */
+template<class T>
+Node<T>::Node(const T& anEntry, Node<T>* nextNode) : 
+   item(anEntry), next(nextNode) {}
+
+/**
+ * Constructor for Node class, which initializes a Node by moving
+ * the specified value, with an optional reference to the next Node
+ * 
+ * @param   anEntry  value to be moved into this Node
+ * @param   nextNode reference to the next Node 
+ */
+template<class T>
+Node<T>::Node(T&& anEntry, Node<T>* nextNode) : 
+   item(std::move(anEntry)), next(nextNode) {}
+
+/**
+ * Assigns the value to be stored in this Node
+ *
+ * @pre              Node must be initialized
+ *
+ * @post             new stored value will be assigned to this 
+ *                   Node
+ * 
+ * @param   anEntry  value to be stored in this Node
+ */
+template<class T>
+void Node<T>::setItem(const T& anEntry) {
+   item = anEntry;
+}
+
+/**
+ * Moves the value to be stored into this Node
+ *
+ * @pre              Node must be initialized
+ *
+ * @post             new stored value will be assigned to this 
+ *                   Node
+ * 
+ * @param   anEntry  value to be moved into this Node
+ */
+template<class T>
+void Node<T>::setItem(T&& anEntry) {
+   item = std::move(anEntry);
+}
+
+/**
+ * Assigns the memory address to the next Node for this Node
+ *
+ * @pre              Node must be initialized
+ *
+ * @post             new memory address will be stored as a 
+ *                   reference to the next Node
+ * 
+ * @param  nextNode  reference to the next Node
+ */
+template<class T>
+void Node<T>::setNext(Node<T>* nextNodePtr) {
+   next = nextNodePtr;
+}
+
+/**
+ * Retrieves the value stored in this Node
+ *
+ * @pre     Node must be initialized with value
+ *
+ * @post    state of this Node does not change
+ *
+ * @return  reference to the value stored in this Node
+ */
+template<class T>
+T& Node<T>::getItem() {
+   return item;
+}
+
+/**
+ * Retrieves the value stored in this Node
+ *
+ * @pre     Node must be initialized with value
+ *
+ * @post    state of this Node does not change
+ *
+ * @return  reference to the value stored in this Node
+ */
+template<class T>
+const T& Node<T>::getItem() const {
+   return item;
+}
+
+/**
+ * Retrieves the reference in memory to the next Node for this 
+ * Node
+ *
+ * @pre     Node must be initialized with next Node reference
+ *
+ * @post    state of this Node does not change
+ *
+ * @return  reference in memory to the next Node
+ */
+template<class T>
+Node<T>* Node<T>::getNext() const {
+   return next;
+}
+// end Node.h
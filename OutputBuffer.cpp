@@ -0,0 +1,72 @@
+/**
+ * OutputBuffer.cpp
+ *
+ * Implementations for the OutputBuffer class, which formats text and
+ * integers with std::to_chars into a large buffer that is handed to
+ * an output stream in bulk writes.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include "OutputBuffer.h"
+
+namespace {
+   /** size of the buffer in bytes */
+   const std::size_t BUFFER_SIZE = 1 << 20;
+}
+
+/**
+ * Constructor for OutputBuffer class
+ *
+ * @param   output   output stream the buffer is written to
+ */
+OutputBuffer::OutputBuffer(std::ostream& output) :
+   buffer(BUFFER_SIZE), used(0), flushed(0), output(output) {}
+
+/**
+ * Destructor for OutputBuffer class that writes any buffered
+ * bytes to the output stream
+ */
+OutputBuffer::~OutputBuffer() {
+   flush();
+}
+
+/**
+ * Appends text of any length, writing the buffer out first if
+ * the text might not fit
+ *
+ * @param   text      text to append
+ */
+void OutputBuffer::write(const char* text) {
+   std::size_t length = std::strlen(text);
+
+   if (used + length > buffer.size()) {
+      flush();
+   }
+   if (length > buffer.size()) {
+      output.write(text, length);
+      flushed += length;
+      return;
+   }
+   appendText(text, length);
+}
+
+/**
+ * Retrieves the number of bytes appended so far, written out or not
+ *
+ * @return   number of bytes appended
+ */
+std::size_t OutputBuffer::getBytesWritten() const {
+   return flushed + used;
+}
+
+/**
+ * Hands the buffered bytes to the output stream in one write
+ */
+void OutputBuffer::flush() {
+   if (used > 0) {
+      output.write(buffer.data(), used);
+      flushed += used;
+      used = 0;
+   }
+} // end OutputBuffer.cpp
@@ -0,0 +1,121 @@
+/**
+ * OutputBuffer.h
+ *
+ * Declarations for the OutputBuffer class, which formats text and
+ * integers with std::to_chars into a large buffer that is handed to
+ * an output stream in bulk writes. Shared by the text writers and
+ * the binary curve writer.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+/**
+ * Represents a buffer in front of an output stream
+ */
+class OutputBuffer {
+public:
+   /** longest text that fits without a check: a few integers and words */
+   static const std::size_t MAX_LINE_SIZE = 128;
+
+   /**
+    * Constructor for OutputBuffer class
+    *
+    * @param   output   output stream the buffer is written to
+    */
+   explicit OutputBuffer(std::ostream& output);
+
+   /**
+    * Destructor for OutputBuffer class that writes any buffered
+    * bytes to the output stream
+    */
+   ~OutputBuffer();
+
+   OutputBuffer(const OutputBuffer&) = delete;
+   OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+   /**
+    * Writes the buffer out if fewer than MAX_LINE_SIZE bytes are
+    * free, so that one line can then be appended without checks
+    *
+    * @post     at least MAX_LINE_SIZE bytes are free
+    */
+   void reserveLine() {
+      if (used + MAX_LINE_SIZE > buffer.size()) {
+         flush();
+      }
+   }
+
+   /**
+    * Appends an integer in decimal
+    *
+    * @pre               reserveLine() left room for the integer
+    *
+    * @param   value     integer to append
+    */
+   void appendInteger(long value) {
+      char* next = std::to_chars(buffer.data() + used,
+         buffer.data() + buffer.size(), value).ptr;
+      used = next - buffer.data();
+   }
+
+   /**
+    * Appends one character
+    *
+    * @pre               reserveLine() left room for the character
+    *
+    * @param   value     character to append
+    */
+   void appendChar(char value) {
+      buffer[used++] = value;
+   }
+
+   /**
+    * Appends text of the specified length
+    *
+    * @pre               reserveLine() left room for the text
+    *
+    * @param   text      text to append
+    * @param   length    number of characters to append
+    */
+   void appendText(const char* text, std::size_t length) {
+      std::memcpy(buffer.data() + used, text, length);
+      used += length;
+   }
+
+   /**
+    * Appends text of any length, writing the buffer out first if
+    * the text might not fit
+    *
+    * @param   text      text to append
+    */
+   void write(const char* text);
+
+   /**
+    * Retrieves the number of bytes appended so far, written out or not
+    *
+    * @return   number of bytes appended
+    */
+   std::size_t getBytesWritten() const;
+
+   /**
+    * Hands the buffered bytes to the output stream in one write
+    */
+   void flush();
+
+private:
+   /** bytes formatted but not yet written to the output stream */
+   std::vector<char> buffer;
+   /** number of bytes used in the buffer */
+   std::size_t used;
+   /** number of bytes already handed to the output stream */
+   std::size_t flushed;
+   /** output stream the buffer is written to */
+   std::ostream& output;
+}; // end OutputBuffer.h
@@ -0,0 +1,155 @@
+/**
+ * PdfWriter.cpp
+ *
+ * Implementations for the PdfWriter class, which writes the Points of
+ * a Koch curve to an output stream as a minimal one page PDF as they
+ * are received.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include <cstdio>
+#include "PdfWriter.h"
+
+/**
+ * Constructor for PdfWriter class
+ *
+ * @param   output   output stream to write PDF to
+ */
+PdfWriter::PdfWriter(std::ostream& output) :
+   buffer(output), output(output), streamStart(0), absolute(false),
+   penXCoord(0), penYCoord(0), priorXCoord(0), priorYCoord(0) {}
+
+/**
+ * Writes the document objects up to the start of the content
+ * stream, followed by the move to the first point
+ *
+ * @pre                 no Points have been added to this writer
+ *
+ * @post                header is sent to the output stream
+ *
+ * @param   firstPoint  first point of the Koch curve
+ * @param   level       Koch level of the curve
+ */
+void PdfWriter::begin(const Point& firstPoint, int level) {
+   buffer.write("%PDF-1.4\n");
+   writeObject("1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+   writeObject("2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\n"
+      "endobj\n");
+   writeObject("3 0 obj\n<< /Type /Page /Parent 2 0 R"
+      " /MediaBox [0 0 612 792] /Contents 4 0 R >>\nendobj\n");
+   writeObject("4 0 obj\n<< /Length 5 0 R >>\nstream\n");
+   streamStart = buffer.getBytesWritten();
+
+   penXCoord = std::lround(firstPoint.getXCoord());
+   penYCoord = std::lround(firstPoint.getYCoord());
+   writeLine(penXCoord, penYCoord, 'm');
+
+   absolute = level == 0;
+   priorXCoord = firstPoint.getXCoord();
+   priorYCoord = firstPoint.getYCoord();
+}
+
+/**
+ * Writes the line to the next Point of the Koch curve. PDF has no
+ * relative lines, so the pen is advanced by the rounded distance
+ * from the prior Point, just like a PostScript rlineto.
+ *
+ * @pre              begin() has been called
+ *
+ * @post             line is sent to the output stream
+ *
+ * @param   point    next Point of the Koch curve
+ */
+void PdfWriter::addPoint(const Point& point) {
+   if (absolute) {
+      penXCoord = std::lround(point.getXCoord());
+      penYCoord = std::lround(point.getYCoord());
+   }
+   else {
+      penXCoord += std::lround(point.getXCoord() - priorXCoord);
+      penYCoord += std::lround(point.getYCoord() - priorYCoord);
+   }
+   writeLine(penXCoord, penYCoord, 'l');
+
+   priorXCoord = point.getXCoord();
+   priorYCoord = point.getYCoord();
+}
+
+/**
+ * Writes the h operator that closes the path
+ *
+ * @pre     begin() has been called
+ *
+ * @post    line is sent to the output stream
+ */
+void PdfWriter::closePath() {
+   buffer.write("h\n");
+}
+
+/**
+ * Ends the content stream, writes its length, the cross-reference
+ * table and the trailer and flushes the output stream
+ *
+ * @pre     begin() has been called
+ *
+ * @post    document is complete on the output stream
+ */
+void PdfWriter::end() {
+   buffer.write("S\n");
+   std::size_t streamLength = buffer.getBytesWritten() - streamStart;
+   buffer.write("endstream\nendobj\n");
+
+   char text[64];
+   std::snprintf(text, sizeof(text), "5 0 obj\n%zu\nendobj\n",
+      streamLength);
+   writeObject(text);
+
+   std::size_t xrefOffset = buffer.getBytesWritten();
+   std::snprintf(text, sizeof(text), "xref\n0 %zu\n",
+      objectOffsets.size() + 1);
+   buffer.write(text);
+
+   // every entry is exactly 20 bytes, including the two byte newline
+   buffer.write("0000000000 65535 f \n");
+   for (std::size_t offset : objectOffsets) {
+      std::snprintf(text, sizeof(text), "%010zu 00000 n \n", offset);
+      buffer.write(text);
+   }
+
+   std::snprintf(text, sizeof(text),
+      "trailer\n<< /Size %zu /Root 1 0 R >>\nstartxref\n%zu\n%%%%EOF\n",
+      objectOffsets.size() + 1, xrefOffset);
+   buffer.write(text);
+
+   buffer.flush();
+   output.flush();
+}
+
+/**
+ * Records the offset of the next object and writes its text
+ *
+ * @param   text       text of the object
+ */
+void PdfWriter::writeObject(const char* text) {
+   objectOffsets.push_back(buffer.getBytesWritten());
+   buffer.write(text);
+}
+
+/**
+ * Appends a path operator holding two integers to the buffer
+ *
+ * @param   xVal       first integer of the line
+ * @param   yVal       second integer of the line
+ * @param   op         path operator ending the line
+ */
+void PdfWriter::writeLine(long xVal, long yVal, char op) {
+   buffer.reserveLine();
+   buffer.appendInteger(xVal);
+   buffer.appendChar(' ');
+   buffer.appendInteger(yVal);
+   buffer.appendChar(' ');
+   buffer.appendChar(op);
+   buffer.appendChar('\n');
+} // end PdfWriter.cpp
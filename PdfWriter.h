@@ -0,0 +1,117 @@
+/**
+ * PdfWriter.h
+ *
+ * Declarations for the PdfWriter class, which writes the Points of a
+ * Koch curve to an output stream as a minimal one page PDF as they
+ * are received. The content stream is written before its length is
+ * known, so the length is an indirect object following the stream,
+ * and the cross-reference table is built from the byte offsets of
+ * the objects as they are written.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "OutputBuffer.h"
+#include "PointSink.h"
+#include "Point.h"
+
+/**
+ * Represents a PointSink that streams a Koch curve as PDF
+ */
+class PdfWriter : public PointSink {
+public:
+   /**
+    * Constructor for PdfWriter class
+    *
+    * @param   output   output stream to write PDF to
+    */
+   explicit PdfWriter(std::ostream& output);
+
+   PdfWriter(const PdfWriter&) = delete;
+   PdfWriter& operator=(const PdfWriter&) = delete;
+
+   /**
+    * Writes the document objects up to the start of the content
+    * stream, followed by the move to the first point
+    *
+    * @pre                 no Points have been added to this writer
+    *
+    * @post                header is sent to the output stream
+    *
+    * @param   firstPoint  first point of the Koch curve
+    * @param   level       Koch level of the curve
+    */
+   void begin(const Point& firstPoint, int level);
+
+   /**
+    * Writes the line to the next Point of the Koch curve. PDF has no
+    * relative lines, so the pen is advanced by the rounded distance
+    * from the prior Point, just like a PostScript rlineto.
+    *
+    * @pre              begin() has been called
+    *
+    * @post             line is sent to the output stream
+    *
+    * @param   point    next Point of the Koch curve
+    */
+   void addPoint(const Point& point);
+
+   /**
+    * Writes the h operator that closes the path
+    *
+    * @pre     begin() has been called
+    *
+    * @post    line is sent to the output stream
+    */
+   void closePath();
+
+   /**
+    * Ends the content stream, writes its length, the cross-reference
+    * table and the trailer and flushes the output stream
+    *
+    * @pre     begin() has been called
+    *
+    * @post    document is complete on the output stream
+    */
+   void end();
+
+private:
+   /**
+    * Records the offset of the next object and writes its text
+    *
+    * @param   text       text of the object
+    */
+   void writeObject(const char* text);
+
+   /**
+    * Appends a path operator holding two integers to the buffer
+    *
+    * @param   xVal       first integer of the line
+    * @param   yVal       second integer of the line
+    * @param   op         path operator ending the line
+    */
+   void writeLine(long xVal, long yVal, char op);
+
+   /** lines formatted but not yet written to the output stream */
+   OutputBuffer buffer;
+   /** output stream to write PDF to */
+   std::ostream& output;
+   /** byte offsets of the objects written so far */
+   std::vector<std::size_t> objectOffsets;
+   /** byte offset of the first byte of the content stream */
+   std::size_t streamStart;
+   /** true if lines are written with absolute coordinates */
+   bool absolute;
+   /** X coordinate of the pen, as drawn by PostScript */
+   long penXCoord;
+   /** Y coordinate of the pen, as drawn by PostScript */
+   long penYCoord;
+   /** X coordinate of the prior Point */
+   double priorXCoord;
+   /** Y coordinate of the prior Point */
+   double priorYCoord;
+}; // end PdfWriter.h
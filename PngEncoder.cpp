@@ -0,0 +1,148 @@
+/**
+ * PngEncoder.cpp
+ *
+ * Implementations for a minimal PNG encoder for 8 bit grayscale
+ * images, storing the image data in uncompressed deflate blocks.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <vector>
+#include "Crc32.h"
+#include "PngEncoder.h"
+
+namespace {
+   /** largest number of bytes in one stored deflate block */
+   const std::size_t MAX_BLOCK_SIZE = 65535;
+
+   /**
+    * Appends a big-endian 32 bit integer
+    */
+   void appendUint32(std::vector<unsigned char>& data,
+      std::uint32_t value) {
+
+      data.push_back((unsigned char) (value >> 24));
+      data.push_back((unsigned char) (value >> 16));
+      data.push_back((unsigned char) (value >> 8));
+      data.push_back((unsigned char) value);
+   }
+
+   /**
+    * Writes one PNG chunk with its length and CRC
+    */
+   void writeChunk(std::ostream& output, const char* type,
+      const std::vector<unsigned char>& data) {
+
+      std::vector<unsigned char> header;
+      appendUint32(header, (std::uint32_t) data.size());
+      header.insert(header.end(), type, type + 4);
+
+      std::uint32_t crc = updateCrc32(0, header.data() + 4, 4);
+      crc = updateCrc32(crc, data.data(), data.size());
+
+      std::vector<unsigned char> trailer;
+      appendUint32(trailer, crc);
+
+      output.write((const char*) header.data(), header.size());
+      output.write((const char*) data.data(), data.size());
+      output.write((const char*) trailer.data(), trailer.size());
+   }
+}
+
+/**
+ * Writes an 8 bit grayscale image in PNG format
+ *
+ * @pre               pixels holds width * height bytes, row by row
+ *                    from the top of the image
+ *
+ * @post              image is sent to the output stream
+ *
+ * @param   output    output stream to write the image to
+ * @param   width     width of the image in pixels
+ * @param   height    height of the image in pixels
+ * @param   pixels    gray levels of the pixels, 0 being black
+ */
+void writePng(std::ostream& output, int width, int height,
+   const unsigned char* pixels) {
+
+   static const unsigned char SIGNATURE[8] =
+      { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+   output.write((const char*) SIGNATURE, sizeof(SIGNATURE));
+
+   // 8 bit grayscale, deflate, adaptive filtering, no interlace
+   std::vector<unsigned char> header;
+   appendUint32(header, (std::uint32_t) width);
+   appendUint32(header, (std::uint32_t) height);
+   header.insert(header.end(), { 8, 0, 0, 0, 0 });
+   writeChunk(output, "IHDR", header);
+
+   // every row starts with filter type 0, none
+   std::vector<unsigned char> rows;
+   rows.reserve((std::size_t) (width + 1) * height);
+   for (int row = 0; row < height; row++) {
+      rows.push_back(0);
+      rows.insert(rows.end(), pixels + (std::size_t) row * width,
+         pixels + (std::size_t) (row + 1) * width);
+   }
+
+   // zlib header for deflate without compression
+   std::vector<unsigned char> data = { 0x78, 0x01 };
+   data.reserve(rows.size() + rows.size() / MAX_BLOCK_SIZE * 5 + 16);
+
+   std::size_t offset = 0;
+   do {
+      std::size_t size = rows.size() - offset;
+      if (size > MAX_BLOCK_SIZE) {
+         size = MAX_BLOCK_SIZE;
+      }
+      bool last = offset + size == rows.size();
+
+      // stored block: final flag, length and its complement
+      data.push_back(last ? 1 : 0);
+      data.push_back((unsigned char) size);
+      data.push_back((unsigned char) (size >> 8));
+      data.push_back((unsigned char) ~size);
+      data.push_back((unsigned char) (~size >> 8));
+      data.insert(data.end(), rows.begin() + offset,
+         rows.begin() + offset + size);
+      offset += size;
+   } while (offset < rows.size());
+
+   appendUint32(data, updateAdler32(1, rows.data(), rows.size()));
+   writeChunk(output, "IDAT", data);
+   writeChunk(output, "IEND", std::vector<unsigned char>());
+   output.flush();
+}
+
+/**
+ * Updates an Adler-32 checksum, as used by zlib streams
+ *
+ * @param   adler     checksum of the prior bytes, 1 to start
+ * @param   data      bytes to add to the checksum
+ * @param   size      number of bytes
+ *
+ * @return            checksum including the bytes
+ */
+std::uint32_t updateAdler32(std::uint32_t adler, const unsigned char* data,
+   std::size_t size) {
+
+   const std::uint32_t MODULUS = 65521;
+   // largest run of bytes whose sums cannot overflow 32 bits
+   const std::size_t RUN_SIZE = 5552;
+
+   std::uint32_t low = adler & 0xffff;
+   std::uint32_t high = adler >> 16;
+
+   while (size > 0) {
+      std::size_t run = size < RUN_SIZE ? size : RUN_SIZE;
+      size -= run;
+
+      while (run-- > 0) {
+         low += *data++;
+         high += low;
+      }
+      low %= MODULUS;
+      high %= MODULUS;
+   }
+   return (high << 16) | low;
+} // end PngEncoder.cpp
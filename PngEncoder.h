@@ -0,0 +1,44 @@
+/**
+ * PngEncoder.h
+ *
+ * Declarations for a minimal PNG encoder for 8 bit grayscale images.
+ * The image data is stored in uncompressed deflate blocks, so no
+ * compression library is needed; the Adler-32 checksum is computed
+ * here and the CRC-32 of every chunk by Crc32.h.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/**
+ * Writes an 8 bit grayscale image in PNG format
+ *
+ * @pre               pixels holds width * height bytes, row by row
+ *                    from the top of the image
+ *
+ * @post              image is sent to the output stream
+ *
+ * @param   output    output stream to write the image to
+ * @param   width     width of the image in pixels
+ * @param   height    height of the image in pixels
+ * @param   pixels    gray levels of the pixels, 0 being black
+ */
+void writePng(std::ostream& output, int width, int height,
+   const unsigned char* pixels);
+
+/**
+ * Updates an Adler-32 checksum, as used by zlib streams
+ *
+ * @param   adler     checksum of the prior bytes, 1 to start
+ * @param   data      bytes to add to the checksum
+ * @param   size      number of bytes
+ *
+ * @return            checksum including the bytes
+ */
+std::uint32_t updateAdler32(std::uint32_t adler, const unsigned char* data,
+   std::size_t size);
+// end PngEncoder.h
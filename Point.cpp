@@ -9,12 +9,14 @@
  * 2020-11-20
  */
 #include <cmath>
+#include <cstdint>
 #include "Point.h"
 
-/**
- * Default constructor for Point class.
- */
-Point::Point() {};
+// storage for the constants, needed where they are bound to references
+template <typename Coord>
+constexpr double BasicPoint<Coord>::KOCH_COS;
+template <typename Coord>
+constexpr double BasicPoint<Coord>::KOCH_SIN;
 
 /**
  * Constructor for Point class, which initializes both X and
@@ -23,7 +25,8 @@ Point::Point() {};
  * @param   xCoord   X coordinate for this Point
  * @param   yCoord   Y coordinate for this Point
  */
-Point::Point(double xCoord, double yCoord) : 
+template <typename Coord>
+BasicPoint<Coord>::BasicPoint(Coord xCoord, Coord yCoord) : 
    xCoord(xCoord), yCoord(yCoord) {}
 
 /**
@@ -35,7 +38,8 @@ Point::Point(double xCoord, double yCoord) :
  *
  * @return  X coordinate for this Point
  */
-double Point::getXCoord() const {
+template <typename Coord>
+Coord BasicPoint<Coord>::getXCoord() const {
     return xCoord;
 }
 
@@ -48,7 +52,8 @@ double Point::getXCoord() const {
  *
  * @return  Y coordinate for this Point
  */
-double Point::getYCoord() const {
+template <typename Coord>
+Coord BasicPoint<Coord>::getYCoord() const {
     return yCoord;
 }
 
@@ -67,22 +72,24 @@ double Point::getYCoord() const {
  * 
  * @return           Point object with rotated X and Y coordinates
  */
-Point Point::rotate(double angle, Point refPoint) const {
+template <typename Coord>
+BasicPoint<Coord> BasicPoint<Coord>::rotate(double angle, 
+   BasicPoint refPoint) const {
    // converts degree rotation to radian value
    double theta = angle * (M_PI / 180.0);
 
    // get central point coordinates
-   double xo = refPoint.getXCoord();
-   double yo = refPoint.getYCoord();
+   double xo = (double) refPoint.getXCoord();
+   double yo = (double) refPoint.getYCoord();
 
    // use trig to calculate rotated coordinates
-   double xModified  = xo + ((xCoord - xo) * cos(theta) -
-      (yCoord - yo) * sin(theta));
-   double yModified  = yo + ((xCoord - xo) * sin(theta) + 
-      (yCoord - yo) * cos(theta));
+   double xModified  = xo + (((double) xCoord - xo) * cos(theta) -
+      ((double) yCoord - yo) * sin(theta));
+   double yModified  = yo + (((double) xCoord - xo) * sin(theta) + 
+      ((double) yCoord - yo) * cos(theta));
    
    // return Point with modified values
-   return Point(xModified, yModified);
+   return BasicPoint(Coord(xModified), Coord(yModified));
 }
 
 /**
@@ -103,21 +110,132 @@ Point Point::rotate(double angle, Point refPoint) const {
  *                   of the identified location between
  *                   this and the specified Point
  */
-Point Point::section(double currLen, double refLen, Point refPoint) 
-const {
+template <typename Coord>
+BasicPoint<Coord> BasicPoint<Coord>::section(double currLen, 
+   double refLen, BasicPoint refPoint) const {
 
-   double xRef = refPoint.getXCoord();
-   double yRef = refPoint.getYCoord();
+   double xRef = (double) refPoint.getXCoord();
+   double yRef = (double) refPoint.getYCoord();
 
-   double xModified = ((refLen * xCoord) + (currLen * xRef)) / 
+   double xModified = ((refLen * (double) xCoord) + (currLen * xRef)) / 
       (currLen + refLen); 
-   double yModified = ((refLen * yCoord) + (currLen * yRef)) /
+   double yModified = ((refLen * (double) yCoord) + (currLen * yRef)) /
       (currLen + refLen);
 
    // return Point with modified values
-   return Point(xModified, yModified);
+   return BasicPoint(Coord(xModified), Coord(yModified));
 };
 
+/**
+ * Retrieves the three interior points of a Koch step from this 
+ * Point to the specified Point. This fuses the two section() calls
+ * and the -60 degree rotate() of a step, using the constant 
+ * rotation coefficients KOCH_COS and KOCH_SIN instead of 
+ * computing them with trigonometry.
+ *
+ * @pre                 Point must be initialized with X and Y 
+ *                      coordinates
+ *
+ * @post                state of this Point does not change
+ * 
+ * @param   end         last point of the segment
+ * @param   firstThird  receives the point one third of the way
+ * @param   tip         receives the tip of the equilateral 
+ *                      triangle over the middle third
+ * @param   secondThird receives the point two thirds of the way
+ */
+template <typename Coord>
+void BasicPoint<Coord>::kochStep(const BasicPoint& end, 
+   BasicPoint& firstThird, BasicPoint& tip, 
+   BasicPoint& secondThird) const {
+
+   // the coefficients in the precision of the coordinates
+   const Coord cosine = (Coord) KOCH_COS;
+   const Coord sine = (Coord) KOCH_SIN;
+
+   // same arithmetic as section(1, 2, end) and section(1, 1, end)
+   Coord fx = (2 * xCoord + end.xCoord) / 3;
+   Coord fy = (2 * yCoord + end.yCoord) / 3;
+   Coord sx = (fx + end.xCoord) / 2;
+   Coord sy = (fy + end.yCoord) / 2;
+
+   // rotate the first third about the second third by -60 degrees
+   Coord dx = fx - sx;
+   Coord dy = fy - sy;
+
+   firstThird = BasicPoint(fx, fy);
+   tip = BasicPoint(sx + (dx * cosine - dy * sine),
+      sy + (dx * sine + dy * cosine));
+   secondThird = BasicPoint(sx, sy);
+}
+
+namespace {
+   /** fraction bits of the fixed-point rotation coefficients */
+   const int ROTATION_BITS = 30;
+
+   /**
+    * Divides and rounds half away from zero
+    *
+    * @param   dividend   number to divide
+    * @param   divisor    positive number to divide by
+    *
+    * @return             nearest integer to the quotient
+    */
+   std::int64_t divideRounded(std::int64_t dividend, 
+      std::int64_t divisor) {
+      return (dividend >= 0 ? dividend + divisor / 2 : 
+         dividend - divisor / 2) / divisor;
+   }
+
+   /**
+    * Retrieves the FixedPoint with the specified raw value
+    */
+   FixedPoint fixed(std::int64_t raw) {
+      return FixedPoint::fromRaw((std::int32_t) raw);
+   }
+}
+
+/**
+ * Retrieves the three interior points of a Koch step of Points with
+ * FixedPoint coordinates, computed on the raw values in 64-bit 
+ * integers and rounded to the nearest FixedPoint
+ *
+ * @pre                 every point of the step is within 
+ *                      FixedPoint::LIMIT
+ *
+ * @param   end         last point of the segment
+ * @param   firstThird  receives the point one third of the way
+ * @param   tip         receives the tip of the equilateral 
+ *                      triangle over the middle third
+ * @param   secondThird receives the point two thirds of the way
+ */
+template <>
+void BasicPoint<FixedPoint>::kochStep(const BasicPoint& end, 
+   BasicPoint& firstThird, BasicPoint& tip, 
+   BasicPoint& secondThird) const {
+
+   const std::int64_t one = std::int64_t(1) << ROTATION_BITS;
+   const std::int64_t cosine = std::llround(KOCH_COS * one);
+   const std::int64_t sine = std::llround(KOCH_SIN * one);
+
+   std::int64_t xStart = xCoord.getRaw();
+   std::int64_t yStart = yCoord.getRaw();
+   std::int64_t xEnd = end.xCoord.getRaw();
+   std::int64_t yEnd = end.yCoord.getRaw();
+
+   std::int64_t fx = divideRounded(2 * xStart + xEnd, 3);
+   std::int64_t fy = divideRounded(2 * yStart + yEnd, 3);
+   std::int64_t sx = divideRounded(fx + xEnd, 2);
+   std::int64_t sy = divideRounded(fy + yEnd, 2);
+   std::int64_t dx = fx - sx;
+   std::int64_t dy = fy - sy;
+
+   firstThird = BasicPoint(fixed(fx), fixed(fy));
+   tip = BasicPoint(fixed(sx + divideRounded(dx * cosine - dy * sine, one)),
+      fixed(sy + divideRounded(dx * sine + dy * cosine, one)));
+   secondThird = BasicPoint(fixed(sx), fixed(sy));
+}
+
 /**
  * Overloads the equality operator for use with Point objects.
  * Allows for determining if two points have the same X and Y
@@ -134,30 +252,14 @@ const {
  * @return        true if this and the right hand side Point
  *                are equal, otherwise false
  */
-bool Point::operator==(Point& rhs) const {
-    if (xCoord == rhs.xCoord || yCoord == rhs.yCoord) {
+template <typename Coord>
+bool BasicPoint<Coord>::operator==(const BasicPoint& rhs) const {
+    if (xCoord == rhs.xCoord && yCoord == rhs.yCoord) {
         return true;
     }
     return false;
 }
 
-/**
- * Overloads the assignment operator for use with Point objects.
- *
- * @pre           Point must be initialized with X and Y 
- *                coordinates
- *
- * @post          right hand side Point values are assigned to 
- *                this Point
- * 
- * @param   rhs   Point object on the right hand side of this
- *                operator
- */
-void Point::operator=(const Point& rhs) {
-    xCoord = rhs.xCoord;
-    yCoord = rhs.yCoord;
-}
-
 /**
  * Overloads the output stream operator for use with Point objects.
  * Allows for outputting the values of this Point into the output
@@ -173,7 +275,20 @@ void Point::operator=(const Point& rhs) {
  *
  * @return           output stream
  */
-std::ostream& operator<<(std::ostream& output, Point point) {
+template <typename Coord>
+std::ostream& operator<<(std::ostream& output, BasicPoint<Coord> point) {
    output << "[" << point.xCoord << "," << point.yCoord << "]";
    return output;
-}; // end Point.cpp
\ No newline at end of file
+};
+
+template class BasicPoint<float>;
+template class BasicPoint<double>;
+template class BasicPoint<FixedPoint>;
+
+template std::ostream& operator<<(std::ostream& output, 
+   BasicPoint<float> point);
+template std::ostream& operator<<(std::ostream& output, 
+   BasicPoint<double> point);
+template std::ostream& operator<<(std::ostream& output, 
+   BasicPoint<FixedPoint> point);
+// end Point.cpp
\ No newline at end of file
@@ -5,16 +5,46 @@
  * with integer values for X and Y coordinates. These Points compose
  * a Koch curve.
  *
+ * Points are a template, BasicPoint, on the type of their 
+ * coordinates. Point has double coordinates; BasicPoint<float> and 
+ * BasicPoint<FixedPoint> hold a curve in half the space, for images 
+ * and previews that do not need the precision.
+ *
  * Joshua Scheck
  * 2020-11-20
  */
 #pragma once
 #include <iostream>
+#include <type_traits>
+#include "FixedPoint.h"
+
+template <typename Coord>
+class BasicPoint;
 
 /**
- * Represents a Point in a Koch curve
+ * Overloads the output stream operator for use with Point objects.
+ * Allows for outputting the values of this Point into the output
+ * stream.
+ *
+ * @pre              Point must be initialized with X and Y 
+ *                   coordinates
+ *
+ * @post             value of this Point is sent to output stream
+ * 
+ * @param   output   output to stream this Point to
+ * @param   point    this Point object 
+ *
+ * @return           output stream
+ */
+template <typename Coord>
+std::ostream& operator<<(std::ostream& output, BasicPoint<Coord> point);
+
+/**
+ * Represents a Point in a Koch curve with coordinates of type Coord:
+ * float, double or FixedPoint
  */
-class Point {
+template <typename Coord>
+class BasicPoint {
 
 /**
  * Overloads the output stream operator for use with Point objects.
@@ -31,13 +61,22 @@ class Point {
  *
  * @return           output stream
  */
-friend std::ostream& operator<<(std::ostream& output, Point point);
+friend std::ostream& operator<< <>(std::ostream& output, 
+   BasicPoint point);
 
 public:
+   /** cosine of the -60 degree rotation of a Koch step tip, as
+       rotate(-60, ...) computes it with cos(-60 * (M_PI / 180)),
+       one unit in the last place above 0.5 */
+   static constexpr double KOCH_COS = 0.50000000000000011;
+   /** sine of the -60 degree rotation of a Koch step tip, as
+       rotate(-60, ...) computes it */
+   static constexpr double KOCH_SIN = -0.8660254037844386;
+
    /**
     * Default constructor for Point class.
     */
-   Point();
+   BasicPoint() = default;
 
    /**
     * Constructor for Point class, which initializes both X and
@@ -46,7 +85,7 @@ public:
     * @param   xCoord   X coordinate for this Point
     * @param   yCoord   Y coordinate for this Point
    */
-   Point(double xCoord, double yCoord);
+   BasicPoint(Coord xCoord, Coord yCoord);
    
    /**
     * Retrieves the X coordinate for this Point
@@ -57,7 +96,7 @@ public:
     *
     * @return  X coordinate for this Point
     */
-   double getXCoord() const;
+   Coord getXCoord() const;
    
    /**
     * Retrieves the Y coordinate for this Point
@@ -68,7 +107,7 @@ public:
     *
     * @return  Y coordinate for this Point
     */
-   double getYCoord() const;
+   Coord getYCoord() const;
 
    /**
     * Retrieves a Point object that is rotated based on the provided
@@ -85,7 +124,7 @@ public:
     * 
     * @return           Point object with rotated X and Y coordinates
     */
-   Point rotate(double angle, Point refPoint) const;
+   BasicPoint rotate(double angle, BasicPoint refPoint) const;
 
    /**
     * Retrieves a Point object based on the specified ratio to
@@ -105,7 +144,29 @@ public:
     *                   of the identified location between
     *                   this and the specified Point
     */
-   Point section(double currLen, double refLen, Point refPoint) const;
+   BasicPoint section(double currLen, double refLen, 
+      BasicPoint refPoint) const;
+
+   /**
+    * Retrieves the three interior points of a Koch step from this 
+    * Point to the specified Point. This fuses the two section() calls
+    * and the -60 degree rotate() of a step, using the constant 
+    * rotation coefficients KOCH_COS and KOCH_SIN instead of 
+    * computing them with trigonometry.
+    *
+    * @pre                 Point must be initialized with X and Y 
+    *                      coordinates
+    *
+    * @post                state of this Point does not change
+    * 
+    * @param   end         last point of the segment
+    * @param   firstThird  receives the point one third of the way
+    * @param   tip         receives the tip of the equilateral 
+    *                      triangle over the middle third
+    * @param   secondThird receives the point two thirds of the way
+    */
+   void kochStep(const BasicPoint& end, BasicPoint& firstThird, 
+      BasicPoint& tip, BasicPoint& secondThird) const;
 
    /**
     * Overloads the equality operator for use with Point objects.
@@ -123,44 +184,45 @@ public:
     * @return        true if this and the right hand side Point
     *                are equal, otherwise false
     */
-   bool operator==(Point& rhs) const;
-
-   /**
-    * Overloads the assignment operator for use with Point objects.
-    *
-    * @pre           Point must be initialized with X and Y 
-    *                coordinates
-    *
-    * @post          right hand side Point values are assigned to 
-    *                this Point
-    * 
-    * @param   rhs   Point object on the right hand side of this
-    *                operator
-    */
-   void operator=(const Point& rhs);
+   bool operator==(const BasicPoint& rhs) const;
 
 private:
    /** X coordinate for this Point */
-   double xCoord;
+   Coord xCoord;
    /** Y coordinate for this Point */
-   double yCoord;
+   Coord yCoord;
 };
 
+/** Point with double coordinates, used to draw every curve */
+typedef BasicPoint<double> Point;
+
 /**
- * Overloads the output stream operator for use with Point objects.
- * Allows for outputting the values of this Point into the output
- * stream.
- *
- * @pre              Point must be initialized with X and Y 
- *                   coordinates
+ * Retrieves the three interior points of a Koch step of Points with
+ * FixedPoint coordinates, computed on the raw values in 64-bit 
+ * integers and rounded to the nearest FixedPoint
  *
- * @post             value of this Point is sent to output stream
- * 
- * @param   output   output to stream this Point to
- * 
- * @param   point    this Point object 
+ * @pre                 every point of the step is within 
+ *                      FixedPoint::LIMIT
  *
- * @return           output stream
+ * @param   end         last point of the segment
+ * @param   firstThird  receives the point one third of the way
+ * @param   tip         receives the tip of the equilateral 
+ *                      triangle over the middle third
+ * @param   secondThird receives the point two thirds of the way
  */
-std::ostream& operator<<(std::ostream& output, Point point);
-// end Point.h
\ No newline at end of file
+template <>
+void BasicPoint<FixedPoint>::kochStep(const BasicPoint& end, 
+   BasicPoint& firstThird, BasicPoint& tip, BasicPoint& secondThird) const;
+
+// the members are compiled once, in Point.cpp, for these types
+extern template class BasicPoint<float>;
+extern template class BasicPoint<double>;
+extern template class BasicPoint<FixedPoint>;
+
+// Points are copied with memcpy and loaded into vector registers
+static_assert(std::is_trivially_copyable<Point>::value,
+   "Point must be trivially copyable");
+static_assert(sizeof(BasicPoint<float>) == sizeof(Point) / 2 &&
+   sizeof(BasicPoint<FixedPoint>) == sizeof(Point) / 2,
+   "narrow Points must take half the space");
+// end Point.h
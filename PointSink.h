@@ -0,0 +1,194 @@
+/**
+ * PointSink.h
+ *
+ * Declarations for the PointSink interface, which receives the Points
+ * of a Koch curve in curve order as they are generated, for the
+ * QueueSink class, which collects those Points into a Queue, for the
+ * TeeSink class, which hands each Point to several PointSinks, and
+ * for the ConvertingSink class, which hands Points of narrower 
+ * coordinates to a PointSink.
+ * PointSink and QueueSink receive Points with double coordinates;
+ * BasicPointSink and BasicQueueSink are the same for any BasicPoint.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <vector>
+#include "Queue.h"
+#include "Point.h"
+
+/**
+ * Represents a consumer of the Points of a Koch curve with 
+ * coordinates of type Coord
+ */
+template <typename Coord>
+class BasicPointSink {
+public:
+   /**
+    * Destructor for PointSink class
+    */
+   virtual ~BasicPointSink() {}
+
+   /**
+    * Signals the start of a Koch curve
+    *
+    * @pre                 no Points have been added to this PointSink
+    *
+    * @post                this PointSink is ready to receive Points
+    *
+    * @param   firstPoint  first point of the Koch curve
+    * @param   level       Koch level of the curve
+    */
+   virtual void begin(const BasicPoint<Coord>& firstPoint, int level) = 0;
+
+   /**
+    * Receives the next Point of the Koch curve
+    *
+    * @pre              begin() has been called
+    *
+    * @post             Point is consumed by this PointSink
+    *
+    * @param   point    next Point of the Koch curve
+    */
+   virtual void addPoint(const BasicPoint<Coord>& point) = 0;
+
+   /**
+    * Signals that the curve returns to its first point with a 
+    * straight line. The closing point itself is not added.
+    *
+    * @pre     begin() has been called
+    *
+    * @post    curve is marked closed
+    */
+   virtual void closePath() {}
+
+   /**
+    * Signals the end of a Koch curve
+    *
+    * @pre     begin() has been called
+    *
+    * @post    all Points received have been consumed
+    */
+   virtual void end() = 0;
+};
+
+/** consumer of Points with double coordinates */
+typedef BasicPointSink<double> PointSink;
+
+/**
+ * Represents a PointSink that stores received Points in a Queue
+ */
+template <typename Coord>
+class BasicQueueSink : public BasicPointSink<Coord> {
+public:
+   /**
+    * Constructor for QueueSink class
+    *
+    * @param   points   Queue receiving the Points
+    */
+   BasicQueueSink(Queue<BasicPoint<Coord> >& points) : points(points) {}
+
+   void begin(const BasicPoint<Coord>& firstPoint, int level) {}
+
+   void addPoint(const BasicPoint<Coord>& point) {
+      points.push(point);
+   }
+
+   void end() {}
+
+private:
+   /** Queue receiving the Points */
+   Queue<BasicPoint<Coord> >& points;
+};
+
+/** PointSink storing Points with double coordinates in a Queue */
+typedef BasicQueueSink<double> QueueSink;
+
+/**
+ * Represents a PointSink that passes every Point on to several
+ * PointSinks, so that one generated curve is written in several
+ * formats at once
+ */
+class TeeSink : public PointSink {
+public:
+   /**
+    * Constructor for TeeSink class
+    *
+    * @param   sinks    PointSinks receiving the Points, in order
+    */
+   TeeSink(const std::vector<PointSink*>& sinks) : sinks(sinks) {}
+
+   void begin(const Point& firstPoint, int level) {
+      for (PointSink* sink : sinks) {
+         sink->begin(firstPoint, level);
+      }
+   }
+
+   void addPoint(const Point& point) {
+      for (PointSink* sink : sinks) {
+         sink->addPoint(point);
+      }
+   }
+
+   void closePath() {
+      for (PointSink* sink : sinks) {
+         sink->closePath();
+      }
+   }
+
+   void end() {
+      for (PointSink* sink : sinks) {
+         sink->end();
+      }
+   }
+
+private:
+   /** PointSinks receiving the Points */
+   std::vector<PointSink*> sinks;
+};
+
+/**
+ * Represents a sink of Points with coordinates of type Coord that 
+ * passes every Point on to a PointSink in double coordinates, so that
+ * curves of any precision are written by the same writers
+ */
+template <typename Coord>
+class ConvertingSink : public BasicPointSink<Coord> {
+public:
+   /**
+    * Constructor for ConvertingSink class
+    *
+    * @param   sink     PointSink receiving the converted Points
+    */
+   ConvertingSink(PointSink& sink) : sink(sink) {}
+
+   void begin(const BasicPoint<Coord>& firstPoint, int level) {
+      sink.begin(convert(firstPoint), level);
+   }
+
+   void addPoint(const BasicPoint<Coord>& point) {
+      sink.addPoint(convert(point));
+   }
+
+   void closePath() {
+      sink.closePath();
+   }
+
+   void end() {
+      sink.end();
+   }
+
+private:
+   /**
+    * Converts a Point to double coordinates, which hold every float
+    * and FixedPoint coordinate exactly
+    */
+   static Point convert(const BasicPoint<Coord>& point) {
+      return Point((double) point.getXCoord(), 
+         (double) point.getYCoord());
+   }
+
+   /** PointSink receiving the converted Points */
+   PointSink& sink;
+}; // end PointSink.h
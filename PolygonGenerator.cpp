@@ -0,0 +1,364 @@
+/**
+ * PolygonGenerator.cpp
+ *
+ * Implementations for the PolygonGenerator class, which draws a Koch
+ * curve on every side of an initiator polyline or closed polygon as
+ * a single path.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include "PolygonGenerator.h"
+#include "Queue.h"
+#include "ThreadPool.h"
+
+namespace {
+   /**
+    * PointSink that passes every point but the last one on to 
+    * another PointSink; the last point of a closed polygon is its
+    * first vertex, which closePath() returns to instead
+    */
+   class DropLastSink : public PointSink {
+   public:
+      DropLastSink(PointSink& sink) : sink(sink), hasPending(false) {}
+
+      void begin(const Point& firstPoint, int level) {}
+
+      void addPoint(const Point& point) {
+         if (hasPending) {
+            sink.addPoint(pending);
+         }
+         pending = point;
+         hasPending = true;
+      }
+
+      void end() {}
+
+   private:
+      /** PointSink receiving the points */
+      PointSink& sink;
+      /** true if a point is held back */
+      bool hasPending;
+      /** point held back in case it is the last */
+      Point pending;
+   };
+}
+
+/**
+ * Constructor for PolygonGenerator class
+ *
+ * @param   vertices  vertices of the initiator, in path order
+ * @param   closed    true if the last vertex connects to the first
+ * @param   level     Koch level to draw
+ *
+ * @throw   std::invalid_argument if there are too few vertices
+ */
+PolygonGenerator::PolygonGenerator(const std::vector<Point>& vertices,
+   bool closed, int level) : 
+   PolygonGenerator(vertices, closed, level, 1, 0) {}
+
+/**
+ * Constructor for PolygonGenerator class, which draws the sides on
+ * the specified number of threads and stops dividing segments
+ * shorter than the resolution
+ *
+ * @param   vertices     vertices of the initiator, in path order
+ * @param   closed       true if the last vertex connects to the 
+ *                       first
+ * @param   level        Koch level to draw
+ * @param   threadCount  number of threads drawing sides
+ * @param   resolution   shortest segment that is still divided,
+ *                       or 0
+ *
+ * @throw   std::invalid_argument if there are too few vertices
+ */
+PolygonGenerator::PolygonGenerator(const std::vector<Point>& vertices,
+   bool closed, int level, int threadCount, double resolution) :
+   closed(closed), threadCount(threadCount), templates(nullptr) {
+
+   if (vertices.size() < (closed ? 3u : 2u)) {
+      throw std::invalid_argument(closed ? 
+         "A polygon needs at least 3 vertices" :
+         "A polyline needs at least 2 vertices");
+   }
+
+   int sideCount = (int) vertices.size() - (closed ? 0 : 1);
+   sides.reserve(sideCount);
+
+   // sides only describe their curve; points are made on output
+   KochOptions options = KochOptions::streamed();
+   options.resolution = resolution;
+
+   for (int i = 0; i < sideCount; i++) {
+      const Point& start = vertices[i];
+      const Point& end = vertices[(i + 1) % vertices.size()];
+
+      sides.emplace_back(start.getXCoord(), start.getYCoord(),
+         end.getXCoord(), end.getYCoord(), level, options);
+   }
+}
+
+/**
+ * Constructor for PolygonGenerator class, which draws the sides on
+ * the specified number of threads by instancing the unit curves 
+ * of a TemplateCache
+ *
+ * @param   vertices     vertices of the initiator, in path order
+ * @param   closed       true if the last vertex connects to the 
+ *                       first
+ * @param   level        Koch level to draw
+ * @param   threadCount  number of threads drawing sides
+ * @param   templates    cache drawing the sides, which must 
+ *                       outlive this PolygonGenerator
+ *
+ * @throw   std::invalid_argument if there are too few vertices
+ */
+PolygonGenerator::PolygonGenerator(const std::vector<Point>& vertices,
+   bool closed, int level, int threadCount, TemplateCache& templates) :
+   PolygonGenerator(vertices, closed, level, threadCount, 0) {
+   this->templates = &templates;
+}
+
+/**
+ * Retrieves the vertices of an equilateral triangle on the 
+ * specified side, ordered so that the bumps of a Koch curve on 
+ * every side point outwards, forming a Koch snowflake
+ *
+ * @param   start    first vertex of the triangle
+ * @param   end      second vertex of the triangle
+ *
+ * @return           the three vertices of the triangle
+ */
+std::vector<Point> PolygonGenerator::snowflake(const Point& start,
+   const Point& end) {
+
+   // bumps rise on the left of each side, so the third vertex is 
+   // on the right and the sides run clockwise
+   double xDelta = end.getXCoord() - start.getXCoord();
+   double yDelta = end.getYCoord() - start.getYCoord();
+   Point third(
+      start.getXCoord() + Point::KOCH_COS * xDelta - 
+         Point::KOCH_SIN * yDelta,
+      start.getYCoord() + Point::KOCH_SIN * xDelta + 
+         Point::KOCH_COS * yDelta);
+
+   return std::vector<Point>{ start, end, third };
+}
+
+/**
+ * Determines if the last vertex connects to the first
+ *
+ * @return  true if the polygon is closed
+ */
+bool PolygonGenerator::isClosed() const {
+   return closed;
+}
+
+/**
+ * Retrieves the number of sides
+ *
+ * @return  number of sides
+ */
+int PolygonGenerator::getSideCount() const {
+   return (int) sides.size();
+}
+
+/**
+ * Retrieves the Koch level of the sides
+ *
+ * @return  Koch curve level
+ */
+int PolygonGenerator::getCurveLevel() const {
+   return sides.front().getCurveLevel();
+}
+
+/**
+ * Retrieves the first point of the path
+ *
+ * @return  first vertex
+ */
+Point PolygonGenerator::getFirstPoint() const {
+   return sides.front().getFirstPoint();
+}
+
+/**
+ * Retrieves the last point of the path, which is the first vertex
+ * of a closed polygon
+ *
+ * @return  last point of the path
+ */
+Point PolygonGenerator::getLastPoint() const {
+   return sides.back().getLastPoint();
+}
+
+/**
+ * Generates the Koch curves of all sides into the specified
+ * PointSink as one path, starting with begin() and finishing 
+ * with end()
+ *
+ * @pre            PolygonGenerator must be initialized
+ *
+ * @post           state of this PolygonGenerator does not change
+ * 
+ * @param   sink   PointSink receiving the points of the path
+ */
+void PolygonGenerator::generate(PointSink& sink) const {
+   sink.begin(getFirstPoint(), getCurveLevel());
+
+   if (threadCount > 1 && sides.size() > 1) {
+      generateParallel(sink);
+   }
+   else {
+      DropLastSink closingSink(sink);
+
+      // each side starts at the last point of the side before it, so
+      // it only adds the points after its first vertex
+      for (std::size_t i = 0; i < sides.size(); i++) {
+         const KochGenerator& side = sides[i];
+         bool closing = closed && i + 1 == sides.size();
+
+         drawSubtree(side, side.getFirstPoint(), side.getLastPoint(),
+            side.getCurveLevel(), closing ? closingSink : sink);
+      }
+   }
+
+   if (closed) {
+      sink.closePath();
+   }
+   sink.end();
+}
+
+/**
+ * Splits the sides into subtrees that are drawn into separate Queues
+ * on a ThreadPool and hands each Queue to the sink in path order as
+ * soon as it and all Queues before it are complete. Only a window of
+ * subtrees is drawn ahead of the sink, so memory use is bounded by 
+ * about 2 * threadCount subtrees rather than by whole sides.
+ *
+ * @param   sink   PointSink receiving the points of the path
+ */
+void PolygonGenerator::generateParallel(PointSink& sink) const {
+   const KochGenerator& firstSide = sides.front();
+   int sideCount = (int) sides.size();
+   int level = firstSide.getCurveLevel();
+
+   // split the top levels of the sides into enough subtrees to keep
+   // every thread busy; templates are only split above 
+   // MAX_TEMPLATE_LEVEL, where TemplateCache takes the same Koch 
+   // steps, so their points do not change either
+   int maxSplitLevel = level;
+   if (templates != nullptr) {
+      maxSplitLevel = std::max(0, 
+         level - TemplateCache::MAX_TEMPLATE_LEVEL);
+   }
+   int splitLevel = 0;
+   while (splitLevel < maxSplitLevel && sideCount * 
+      firstSide.getRule().countSegments(splitLevel) < threadCount * 16) {
+      splitLevel++;
+   }
+   int subtreeLevel = level - splitLevel;
+
+   // the end points of the level splitLevel curve of every side are 
+   // the end points of its subtrees, computed exactly as the full 
+   // recursion would; subtree i runs from corners[i] to 
+   // corners[i + 1] on side subtreeSides[i]
+   std::vector<Point> corners(1, getFirstPoint());
+   std::vector<const KochGenerator*> subtreeSides;
+   for (const KochGenerator& side : sides) {
+      Queue<Point> ends;
+      QueueSink endSink(ends);
+      side.drawKoch(side.getFirstPoint().getXCoord(), 
+         side.getFirstPoint().getYCoord(), 
+         side.getLastPoint().getXCoord(),
+         side.getLastPoint().getYCoord(), splitLevel, endSink);
+
+      for (const Point& end : ends) {
+         corners.push_back(end);
+         subtreeSides.push_back(&side);
+      }
+   }
+
+   int subtreeCount = (int) subtreeSides.size();
+   std::vector<Queue<Point> > segments(subtreeCount);
+   std::vector<bool> finished(subtreeCount, false);
+   std::mutex finishedLock;
+   std::condition_variable segmentFinished;
+
+   {
+      ThreadPool pool(threadCount);
+
+      auto submitSubtree = [this, &pool, &corners, &subtreeSides, 
+         subtreeLevel, &segments, &finished, &finishedLock, 
+         &segmentFinished](int i) {
+         pool.submit([this, i, &corners, &subtreeSides, subtreeLevel,
+            &segments, &finished, &finishedLock, &segmentFinished] {
+            QueueSink segmentSink(segments[i]);
+            drawSubtree(*subtreeSides[i], corners[i], corners[i + 1], 
+               subtreeLevel, segmentSink);
+
+            std::lock_guard<std::mutex> guard(finishedLock);
+            finished[i] = true;
+            segmentFinished.notify_all();
+         });
+      };
+
+      int window = std::min(subtreeCount, 2 * threadCount);
+      for (int i = 0; i < window; i++) {
+         submitSubtree(i);
+      }
+
+      // stitch subtrees together in path order while later ones are
+      // still being drawn
+      for (int i = 0; i < subtreeCount; i++) {
+         {
+            std::unique_lock<std::mutex> guard(finishedLock);
+            segmentFinished.wait(guard, [&finished, i] { 
+               return finished[i]; 
+            });
+         }
+
+         Queue<Point>& segment = segments[i];
+         int count = segment.getCurrentSize();
+         if (closed && i + 1 == subtreeCount) {
+            count--;
+         }
+
+         Queue<Point>::const_iterator point = segment.begin();
+         for (int j = 0; j < count; j++, ++point) {
+            sink.addPoint(*point);
+         }
+         segment.clear();
+
+         if (i + window < subtreeCount) {
+            submitSubtree(i + window);
+         }
+      }
+   }
+}
+
+/**
+ * Adds the points of a subtree of a side after its first point to
+ * the sink
+ *
+ * @param   side   Koch curve of the side
+ * @param   start  first point of the subtree
+ * @param   end    last point of the subtree
+ * @param   level  Koch level of the subtree
+ * @param   sink   PointSink receiving the points
+ */
+void PolygonGenerator::drawSubtree(const KochGenerator& side, 
+   const Point& start, const Point& end, int level, 
+   PointSink& sink) const {
+
+   if (templates != nullptr) {
+      templates->drawKoch(start, end, level, sink);
+   }
+   else {
+      side.drawKoch(start.getXCoord(), start.getYCoord(), 
+         end.getXCoord(), end.getYCoord(), level, sink);
+   }
+} // end PolygonGenerator.cpp
@@ -0,0 +1,173 @@
+/**
+ * PolygonGenerator.h
+ *
+ * Declarations for the PolygonGenerator class, which draws a Koch 
+ * curve on every side of an initiator polyline or closed polygon, 
+ * such as the triangle of a Koch snowflake, as a single path. Each
+ * side is a KochGenerator; on several threads the sides are split 
+ * into subtrees that are drawn in parallel and stitched back 
+ * together in order. A vertex shared
+ * by two sides is written once, and a closed polygon ends with 
+ * closePath() instead of repeating its first vertex. Sides may be
+ * drawn from a shared TemplateCache instead of by recursion.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <vector>
+#include "KochGenerator.h"
+#include "Point.h"
+#include "PointSink.h"
+#include "TemplateCache.h"
+
+/**
+ * Represents a Koch curve drawn on the sides of a polygon
+ */
+class PolygonGenerator {
+public:
+   /**
+    * Constructor for PolygonGenerator class
+    *
+    * @param   vertices  vertices of the initiator, in path order
+    * @param   closed    true if the last vertex connects to the first
+    * @param   level     Koch level to draw
+    *
+    * @throw   std::invalid_argument if there are too few vertices
+    */
+   PolygonGenerator(const std::vector<Point>& vertices, bool closed,
+      int level);
+
+   /**
+    * Constructor for PolygonGenerator class, which draws the sides on
+    * the specified number of threads and stops dividing segments
+    * shorter than the resolution
+    *
+    * @param   vertices     vertices of the initiator, in path order
+    * @param   closed       true if the last vertex connects to the 
+    *                       first
+    * @param   level        Koch level to draw
+    * @param   threadCount  number of threads drawing sides
+    * @param   resolution   shortest segment that is still divided,
+    *                       or 0
+    *
+    * @throw   std::invalid_argument if there are too few vertices
+    */
+   PolygonGenerator(const std::vector<Point>& vertices, bool closed,
+      int level, int threadCount, double resolution);
+
+   /**
+    * Constructor for PolygonGenerator class, which draws the sides on
+    * the specified number of threads by instancing the unit curves 
+    * of a TemplateCache
+    *
+    * @param   vertices     vertices of the initiator, in path order
+    * @param   closed       true if the last vertex connects to the 
+    *                       first
+    * @param   level        Koch level to draw
+    * @param   threadCount  number of threads drawing sides
+    * @param   templates    cache drawing the sides, which must 
+    *                       outlive this PolygonGenerator
+    *
+    * @throw   std::invalid_argument if there are too few vertices
+    */
+   PolygonGenerator(const std::vector<Point>& vertices, bool closed,
+      int level, int threadCount, TemplateCache& templates);
+
+   /**
+    * Retrieves the vertices of an equilateral triangle on the 
+    * specified side, ordered so that the bumps of a Koch curve on 
+    * every side point outwards, forming a Koch snowflake
+    *
+    * @param   start    first vertex of the triangle
+    * @param   end      second vertex of the triangle
+    *
+    * @return           the three vertices of the triangle
+    */
+   static std::vector<Point> snowflake(const Point& start, 
+      const Point& end);
+
+   /**
+    * Determines if the last vertex connects to the first
+    *
+    * @return  true if the polygon is closed
+    */
+   bool isClosed() const;
+
+   /**
+    * Retrieves the number of sides
+    *
+    * @return  number of sides
+    */
+   int getSideCount() const;
+
+   /**
+    * Retrieves the Koch level of the sides
+    *
+    * @return  Koch curve level
+    */
+   int getCurveLevel() const;
+
+   /**
+    * Retrieves the first point of the path
+    *
+    * @return  first vertex
+    */
+   Point getFirstPoint() const;
+
+   /**
+    * Retrieves the last point of the path, which is the first vertex
+    * of a closed polygon
+    *
+    * @return  last point of the path
+    */
+   Point getLastPoint() const;
+
+   /**
+    * Generates the Koch curves of all sides into the specified
+    * PointSink as one path, starting with begin() and finishing 
+    * with end()
+    *
+    * @pre            PolygonGenerator must be initialized
+    *
+    * @post           state of this PolygonGenerator does not change
+    * 
+    * @param   sink   PointSink receiving the points of the path
+    */
+   void generate(PointSink& sink) const;
+
+private:
+   /**
+    * Splits the sides into subtrees that are drawn into separate 
+    * Queues on a ThreadPool and hands each Queue to the sink in path
+    * order as soon as it and all Queues before it are complete. Only
+    * a window of subtrees is drawn ahead of the sink, so memory use 
+    * is bounded by about 2 * threadCount subtrees rather than by 
+    * whole sides.
+    *
+    * @param   sink   PointSink receiving the points of the path
+    */
+   void generateParallel(PointSink& sink) const;
+
+   /**
+    * Adds the points of a subtree of a side after its first point to
+    * the sink
+    *
+    * @param   side   Koch curve of the side
+    * @param   start  first point of the subtree
+    * @param   end    last point of the subtree
+    * @param   level  Koch level of the subtree
+    * @param   sink   PointSink receiving the points
+    */
+   void drawSubtree(const KochGenerator& side, const Point& start,
+      const Point& end, int level, PointSink& sink) const;
+
+   /** Koch curve of every side, in path order */
+   std::vector<KochGenerator> sides;
+   /** true if the last vertex connects to the first */
+   bool closed;
+   /** number of threads drawing sides */
+   int threadCount;
+   /** cache drawing the sides, or nullptr to draw them recursively */
+   TemplateCache* templates;
+}; // end PolygonGenerator.h
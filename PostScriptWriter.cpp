@@ -0,0 +1,146 @@
+/**
+ * PostScriptWriter.cpp
+ *
+ * Implementations for the PostScriptWriter class, which writes the
+ * Points of a Koch curve to an output stream in .ps file format as
+ * they are received. Lines are formatted into an OutputBuffer that
+ * is handed to the stream in bulk writes.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include "PostScriptWriter.h"
+
+/**
+ * Constructor for PostScriptWriter class
+ *
+ * @param   output   output stream to write PostScript to
+ */
+PostScriptWriter::PostScriptWriter(std::ostream& output) :
+   PostScriptWriter(output, false) {}
+
+/**
+ * Constructor for PostScriptWriter class, which may write only
+ * the lines of the curve, leaving out the PostScript header and
+ * trailer, so that slices of one curve can be concatenated later
+ *
+ * @param   output     output stream to write PostScript to
+ * @param   linesOnly  true if the header and trailer are left out
+ */
+PostScriptWriter::PostScriptWriter(std::ostream& output, bool linesOnly) :
+   buffer(output), output(output), linesOnly(linesOnly),
+   absolute(false), priorXCoord(0), priorYCoord(0) {}
+
+/**
+ * Writes the PostScript header and the moveto for the first point
+ *
+ * @pre                 no Points have been added to this writer
+ *
+ * @post                header is sent to the output stream
+ *
+ * @param   firstPoint  first point of the Koch curve
+ * @param   level       Koch level of the curve
+ */
+void PostScriptWriter::begin(const Point& firstPoint, int level) {
+   if (!linesOnly) {
+      buffer.write("%!PS-Adobe-2.0\n");
+   }
+
+   writeLine(std::lround(firstPoint.getXCoord()),
+      std::lround(firstPoint.getYCoord()), "moveto", 6);
+
+   resume(firstPoint, level);
+}
+
+/**
+ * Continues a curve after the specified point without writing
+ * anything, so that the next line is relative to that point
+ *
+ * @pre                 no Points have been added to this writer
+ *
+ * @post                next Point is written relative to priorPoint
+ *
+ * @param   priorPoint  point preceding the next Point of the curve
+ * @param   level       Koch level of the curve
+ */
+void PostScriptWriter::resume(const Point& priorPoint, int level) {
+   absolute = level == 0;
+   priorXCoord = priorPoint.getXCoord();
+   priorYCoord = priorPoint.getYCoord();
+}
+
+/**
+ * Writes the line to the next Point of the Koch curve. Level 0
+ * curves are written with an absolute lineto, all other levels
+ * with an rlineto relative to the prior Point.
+ *
+ * @pre              begin() has been called
+ *
+ * @post             line is sent to the output stream
+ *
+ * @param   point    next Point of the Koch curve
+ */
+void PostScriptWriter::addPoint(const Point& point) {
+   if (absolute) {
+      writeLine(std::lround(point.getXCoord()),
+         std::lround(point.getYCoord()), "lineto", 6);
+   }
+   else {
+      // output adjusted coordinates
+      writeLine(std::lround(point.getXCoord() - priorXCoord),
+         std::lround(point.getYCoord() - priorYCoord), "rlineto", 7);
+   }
+
+   // assign prior point coordinates
+   priorXCoord = point.getXCoord();
+   priorYCoord = point.getYCoord();
+}
+
+/**
+ * Writes the closepath that closes the path
+ *
+ * @pre     begin() has been called
+ *
+ * @post    line is sent to the output stream
+ */
+void PostScriptWriter::closePath() {
+   buffer.write("closepath\n");
+}
+
+/**
+ * Writes the PostScript trailer and flushes the output stream
+ *
+ * @pre     begin() has been called
+ *
+ * @post    trailer and all buffered lines are sent to the output
+ *          stream
+ */
+void PostScriptWriter::end() {
+   if (!linesOnly) {
+      buffer.write("stroke\nshowpage\n");
+   }
+   buffer.flush();
+   output.flush();
+}
+
+/**
+ * Appends a line holding two integers and an operator to the
+ * buffer
+ *
+ * @param   xVal       first integer of the line
+ * @param   yVal       second integer of the line
+ * @param   op         PostScript operator ending the line
+ * @param   opLength   number of characters in op
+ */
+void PostScriptWriter::writeLine(long xVal, long yVal, const char* op,
+   std::size_t opLength) {
+
+   buffer.reserveLine();
+   buffer.appendInteger(xVal);
+   buffer.appendChar('\t');
+   buffer.appendInteger(yVal);
+   buffer.appendChar('\t');
+   buffer.appendText(op, opLength);
+   buffer.appendChar('\n');
+} // end PostScriptWriter.cpp
@@ -0,0 +1,125 @@
+/**
+ * PostScriptWriter.h
+ *
+ * Declarations for the PostScriptWriter class, which writes the
+ * Points of a Koch curve to an output stream in .ps file format as
+ * they are received. Lines are formatted into an OutputBuffer that
+ * is handed to the stream in bulk writes.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <iostream>
+#include "OutputBuffer.h"
+#include "PointSink.h"
+#include "Point.h"
+
+/**
+ * Represents a PointSink that streams a Koch curve as PostScript
+ */
+class PostScriptWriter : public PointSink {
+public:
+   /**
+    * Constructor for PostScriptWriter class
+    *
+    * @param   output   output stream to write PostScript to
+    */
+   PostScriptWriter(std::ostream& output);
+
+   /**
+    * Constructor for PostScriptWriter class, which may write only
+    * the lines of the curve, leaving out the PostScript header and
+    * trailer, so that slices of one curve can be concatenated later
+    *
+    * @param   output     output stream to write PostScript to
+    * @param   linesOnly  true if the header and trailer are left out
+    */
+   PostScriptWriter(std::ostream& output, bool linesOnly);
+
+   PostScriptWriter(const PostScriptWriter&) = delete;
+   PostScriptWriter& operator=(const PostScriptWriter&) = delete;
+
+   /**
+    * Writes the PostScript header and the moveto for the first point
+    *
+    * @pre                 no Points have been added to this writer
+    *
+    * @post                header is sent to the output stream
+    *
+    * @param   firstPoint  first point of the Koch curve
+    * @param   level       Koch level of the curve
+    */
+   void begin(const Point& firstPoint, int level);
+
+   /**
+    * Continues a curve after the specified point without writing
+    * anything, so that the next line is relative to that point
+    *
+    * @pre                 no Points have been added to this writer
+    *
+    * @post                next Point is written relative to priorPoint
+    *
+    * @param   priorPoint  point preceding the next Point of the curve
+    * @param   level       Koch level of the curve
+    */
+   void resume(const Point& priorPoint, int level);
+
+   /**
+    * Writes the line to the next Point of the Koch curve. Level 0
+    * curves are written with an absolute lineto, all other levels
+    * with an rlineto relative to the prior Point.
+    *
+    * @pre              begin() has been called
+    *
+    * @post             line is sent to the output stream
+    *
+    * @param   point    next Point of the Koch curve
+    */
+   void addPoint(const Point& point);
+
+   /**
+    * Writes the closepath that closes the path
+    *
+    * @pre     begin() has been called
+    *
+    * @post    line is sent to the output stream
+    */
+   void closePath();
+
+   /**
+    * Writes the PostScript trailer and flushes the output stream
+    *
+    * @pre     begin() has been called
+    *
+    * @post    trailer and all buffered lines are sent to the output
+    *          stream
+    */
+   void end();
+
+private:
+   /**
+    * Appends a line holding two integers and an operator to the
+    * buffer
+    *
+    * @param   xVal       first integer of the line
+    * @param   yVal       second integer of the line
+    * @param   op         PostScript operator ending the line
+    * @param   opLength   number of characters in op
+    */
+   void writeLine(long xVal, long yVal, const char* op,
+      std::size_t opLength);
+
+   /** lines formatted but not yet written to the output stream */
+   OutputBuffer buffer;
+   /** output stream to write PostScript to */
+   std::ostream& output;
+   /** true if the header and trailer are left out */
+   bool linesOnly;
+   /** true if lines are written with absolute coordinates */
+   bool absolute;
+   /** X coordinate of the prior Point */
+   double priorXCoord;
+   /** Y coordinate of the prior Point */
+   double priorYCoord;
+}; // end PostScriptWriter.h
@@ -0,0 +1,180 @@
+/**
+ * PrecisionGenerator.cpp
+ *
+ * Implementations for the PrecisionGenerator class, which draws Koch
+ * curves with coordinates of type Coord: float, double or FixedPoint.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "KochGenerator.h"
+#include "PrecisionGenerator.h"
+
+namespace {
+   /**
+    * Retrieves the largest magnitude a coordinate of type Coord holds
+    *
+    * @return  largest coordinate magnitude
+    */
+   template <typename Coord>
+   double coordinateLimit() {
+      return std::numeric_limits<Coord>::max();
+   }
+
+   /**
+    * Retrieves the largest magnitude a FixedPoint coordinate holds
+    *
+    * @return  largest coordinate magnitude
+    */
+   template <>
+   double coordinateLimit<FixedPoint>() {
+      return FixedPoint::LIMIT;
+   }
+
+   /**
+    * Predicate of drawKochCurve that divides every segment down to 
+    * level 0, as PrecisionGenerator curves have no resolution
+    */
+   struct NeverStraight {
+      template <typename Coord>
+      bool operator()(const BasicPoint<Coord>&, const BasicPoint<Coord>&)
+         const {
+
+         return false;
+      }
+   };
+}
+
+/**
+ * Constructor for PrecisionGenerator class. A streaming 
+ * PrecisionGenerator does not store its points; they are 
+ * generated each time the curve is generated.
+ *
+ * @param   x1        X coordinate of first point
+ * @param   y1        Y coordinate of first point
+ * @param   x2        X coordinate of second point
+ * @param   y2        Y coordinate of second point
+ * @param   level     Koch level to draw
+ * @param   streaming true if points should not be stored
+ *
+ * @throw   std::invalid_argument if the curve does not fit in 
+ *          coordinates of type Coord
+ */
+template <typename Coord>
+PrecisionGenerator<Coord>::PrecisionGenerator(double x1, double y1, 
+   double x2, double y2, int level, bool streaming) :
+   firstPoint(Coord(x1), Coord(y1)), lastPoint(Coord(x2), Coord(y2)),
+   curveLevel(level), streaming(streaming) {
+
+   // the curve lies in the triangle of its ends and the tip of its
+   // first step, so the curve fits if those three points do
+   Point firstThird;
+   Point tip;
+   Point secondThird;
+   Point(x1, y1).kochStep(Point(x2, y2), firstThird, tip, secondThird);
+   double extent = std::fmax(std::fmax(std::fabs(x1), std::fabs(y1)),
+      std::fmax(std::fabs(x2), std::fabs(y2)));
+   extent = std::fmax(extent, std::fmax(std::fabs(tip.getXCoord()), 
+      std::fabs(tip.getYCoord())));
+
+   if (!(extent <= coordinateLimit<Coord>())) {
+      throw std::invalid_argument("Curve does not fit in the coordinates of "
+         "the generator");
+   }
+
+   if (!streaming) {
+      if (level <= 15) {
+         points.reserve(1 << (2 * level));
+      }
+
+      BasicQueueSink<Coord> sink(points);
+      drawKochCurve(firstPoint, lastPoint, level, sink, NeverStraight());
+   }
+}
+
+/**
+ * Determines if this PrecisionGenerator streams its points 
+ * instead of storing them
+ *
+ * @return  true if points are not stored, false otherwise
+ */
+template <typename Coord>
+bool PrecisionGenerator<Coord>::isStreaming() const {
+   return streaming;
+}
+
+/**
+ * Retrieves the Koch level of the curve
+ *
+ * @return  Koch curve level
+ */
+template <typename Coord>
+int PrecisionGenerator<Coord>::getCurveLevel() const {
+   return curveLevel;
+}
+
+/**
+ * Retrieves the first point of the curve
+ *
+ * @return  first point of the curve
+ */
+template <typename Coord>
+BasicPoint<Coord> PrecisionGenerator<Coord>::getFirstPoint() const {
+   return firstPoint;
+}
+
+/**
+ * Retrieves the last point of the curve
+ *
+ * @return  last point of the curve
+ */
+template <typename Coord>
+BasicPoint<Coord> PrecisionGenerator<Coord>::getLastPoint() const {
+   return lastPoint;
+}
+
+/**
+ * Retrieves the number of points in the Koch curve, including the
+ * first point, which is 4^level + 1
+ *
+ * @pre     level is at most 31
+ *
+ * @return  number of points in the curve
+ */
+template <typename Coord>
+long long PrecisionGenerator<Coord>::getPointCount() const {
+   return (1LL << (2 * curveLevel)) + 1;
+}
+
+/**
+ * Generates the whole Koch curve into the specified sink, starting
+ * with begin() and finishing with end()
+ *
+ * @param   sink   sink receiving the points of the curve
+ */
+template <typename Coord>
+void PrecisionGenerator<Coord>::generate(BasicPointSink<Coord>& sink) 
+   const {
+
+   sink.begin(firstPoint, curveLevel);
+
+   if (streaming) {
+      drawKochCurve(firstPoint, lastPoint, curveLevel, sink, 
+         NeverStraight());
+   }
+   else {
+      for (const BasicPoint<Coord>& point : points) {
+         sink.addPoint(point);
+      }
+   }
+
+   sink.end();
+}
+
+template class PrecisionGenerator<float>;
+template class PrecisionGenerator<double>;
+template class PrecisionGenerator<FixedPoint>;
+// end PrecisionGenerator.cpp
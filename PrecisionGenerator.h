@@ -0,0 +1,115 @@
+/**
+ * PrecisionGenerator.h
+ *
+ * Declarations for the PrecisionGenerator class, which draws Koch 
+ * curves with coordinates of type Coord: float, double or FixedPoint.
+ * Every Koch step is computed by BasicPoint<Coord>::kochStep in the 
+ * precision of the coordinates, and stored curves are kept in a 
+ * Queue of BasicPoint<Coord>, so float and FixedPoint curves take 
+ * half the memory of double ones.
+ *
+ * The curve is drawn by drawKochCurve, the recursion KochGenerator 
+ * uses for Koch curves, so PrecisionGenerator<double> produces 
+ * exactly the points of KochGenerator. Only that recursion is shared:
+ * rules, threads, resolutions, tables and ranges remain features of
+ * KochGenerator, and this generator draws just the single Koch 
+ * curves of --precision float and fixed, whose points reach the 
+ * writers through a ConvertingSink.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include "Point.h"
+#include "PointSink.h"
+#include "Queue.h"
+
+/**
+ * Represents a Koch curve with coordinates of type Coord
+ */
+template <typename Coord>
+class PrecisionGenerator {
+public:
+   /**
+    * Constructor for PrecisionGenerator class. A streaming 
+    * PrecisionGenerator does not store its points; they are 
+    * generated each time the curve is generated.
+    *
+    * @param   x1        X coordinate of first point
+    * @param   y1        Y coordinate of first point
+    * @param   x2        X coordinate of second point
+    * @param   y2        Y coordinate of second point
+    * @param   level     Koch level to draw
+    * @param   streaming true if points should not be stored
+    *
+    * @throw   std::invalid_argument if the curve does not fit in 
+    *          coordinates of type Coord
+    */
+   PrecisionGenerator(double x1, double y1, double x2, double y2, 
+      int level, bool streaming);
+
+   /**
+    * Determines if this PrecisionGenerator streams its points 
+    * instead of storing them
+    *
+    * @return  true if points are not stored, false otherwise
+    */
+   bool isStreaming() const;
+
+   /**
+    * Retrieves the Koch level of the curve
+    *
+    * @return  Koch curve level
+    */
+   int getCurveLevel() const;
+
+   /**
+    * Retrieves the first point of the curve
+    *
+    * @return  first point of the curve
+    */
+   BasicPoint<Coord> getFirstPoint() const;
+
+   /**
+    * Retrieves the last point of the curve
+    *
+    * @return  last point of the curve
+    */
+   BasicPoint<Coord> getLastPoint() const;
+
+   /**
+    * Retrieves the number of points in the Koch curve, including the
+    * first point, which is 4^level + 1
+    *
+    * @pre     level is at most 31
+    *
+    * @return  number of points in the curve
+    */
+   long long getPointCount() const;
+
+   /**
+    * Generates the whole Koch curve into the specified sink, starting
+    * with begin() and finishing with end()
+    *
+    * @param   sink   sink receiving the points of the curve
+    */
+   void generate(BasicPointSink<Coord>& sink) const;
+
+private:
+   /** stored points of the curve after the first */
+   Queue<BasicPoint<Coord> > points;
+   /** first point of the curve */
+   BasicPoint<Coord> firstPoint;
+   /** last point of the curve */
+   BasicPoint<Coord> lastPoint;
+   /** Koch curve level */
+   int curveLevel;
+   /** true if points are generated on output instead of stored */
+   bool streaming;
+};
+
+// the members are compiled once, in PrecisionGenerator.cpp
+extern template class PrecisionGenerator<float>;
+extern template class PrecisionGenerator<double>;
+extern template class PrecisionGenerator<FixedPoint>;
+// end PrecisionGenerator.h
@@ -1,29 +1,113 @@
 /**
  * Queue.h
  *
- * Declarations for the Queue class, which initializes as an empty
- * Queue ADT but can be populated with Nodes added sequently at the 
- * end of the Queue. Furthermore, Nodes can be removed from the top
- * of the Queue.
+ * Declarations and implementations for the Queue class, which 
+ * initializes as an empty Queue ADT but can be populated with entries
+ * added sequently at the end of the Queue. Furthermore, entries can 
+ * be removed from the top of the Queue. Entries are stored 
+ * contiguously in a circular buffer that grows geometrically and can
+ * be pre-sized with reserve(). The buffer is obtained from an 
+ * Allocator, so a Queue can draw its memory from a MonotonicArena
+ * through an ArenaAllocator. Entries can be read in order, front to
+ * back, with a const_iterator without removing them. Entries are 
+ * moved rather than copied wherever possible, and whole Queues are
+ * moved in constant time by handing over their buffer.
  *
  * Joshua Scheck
  * 2020-11-20
  */
 #pragma once
-#include "Node.h"
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
 
 /**
- * Represents a Queue ADT that stores values as Nodes
+ * Represents a Queue ADT that stores values in a contiguous circular
+ * buffer
  */
-template<class T>
+template<class T, class Allocator = std::allocator<T> >
 class Queue {
 public:
+  /**
+   * Represents a read-only position in a Queue, advancing from the 
+   * front entry towards the back
+   */
+  class const_iterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T* pointer;
+    typedef const T& reference;
+
+    /**
+     * Default constructor for const_iterator class. Initializes an
+     * iterator that belongs to no Queue.
+     */
+    const_iterator() : queue(nullptr), position(0) {}
+
+    /**
+     * Constructor for const_iterator class
+     *
+     * @param   queue      Queue to iterate over
+     * @param   position   number of entries from the front
+     */
+    const_iterator(const Queue* queue, int position) : 
+      queue(queue), position(position) {}
+
+    reference operator*() const {
+      return queue->items[queue->indexOf(position)];
+    }
+
+    pointer operator->() const {
+      return &**this;
+    }
+
+    const_iterator& operator++() {
+      position++;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator prior = *this;
+      position++;
+      return prior;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return queue == other.queue && position == other.position;
+    }
+
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+  private:
+    /** Queue iterated over. */
+    const Queue* queue;
+    /** Number of entries from the front of the Queue. */
+    int position;
+  };
+
   /**
    * Default constructor for this Queue class. Initializes an empty
    * Queue.
    */
   Queue();
 
+  /**
+   * Constructor for this Queue class. Initializes an empty Queue 
+   * that obtains its buffer from the specified Allocator.
+   * 
+   * @param   allocator   Allocator providing memory for entries
+   */
+  explicit Queue(const Allocator& allocator);
+
   /**
    * Copy constructor for this Queue class
    * 
@@ -32,6 +116,62 @@ public:
    */ 
   Queue(const Queue& otherQueue);
 
+  /**
+   * Move constructor for this Queue class, which takes over the 
+   * buffer of another Queue in constant time
+   * 
+   * @param   otherQueue  Queue whose entries are moved to this Queue;
+   *                      left empty
+   */ 
+  Queue(Queue&& otherQueue) noexcept;
+
+  /**
+   * Copy assignment operator for this Queue class
+   *
+   * @pre                 Queue must be initialized
+   *
+   * @post                this Queue holds copies of the entries of
+   *                      otherQueue, in order
+   * 
+   * @param   otherQueue  values from another Queue to be deep copied
+   *                      to this Queue
+   *
+   * @return              this Queue
+   */
+  Queue& operator=(const Queue& otherQueue);
+
+  /**
+   * Move assignment operator for this Queue class, which takes over
+   * the buffer of another Queue in constant time when the allocators
+   * allow it
+   *
+   * @pre                 Queue must be initialized
+   *
+   * @post                this Queue holds the entries of otherQueue, 
+   *                      which is left empty
+   * 
+   * @param   otherQueue  Queue whose entries are moved to this Queue
+   *
+   * @return              this Queue
+   */
+  Queue& operator=(Queue&& otherQueue) noexcept(
+    std::allocator_traits<Allocator>::
+      propagate_on_container_move_assignment::value);
+
+  /**
+   * Exchanges the entries of this Queue with those of another Queue
+   * in constant time
+   *
+   * @pre                 both Queues must be initialized with equal
+   *                      allocators, unless the allocators propagate
+   *                      on swap
+   *
+   * @post                each Queue holds the entries of the other
+   * 
+   * @param   otherQueue  Queue to exchange entries with
+   */
+  void swap(Queue& otherQueue) noexcept;
+
   /**
    * Destructor for this Queue class that destroys this Queue
    * and frees memory allocated by the object.
@@ -40,123 +180,940 @@ public:
    *
    * @pre     Queue must be initialized
    *
-   * @post    this Queue is destructed with all prior Nodes being 
+   * @post    this Queue is destructed with its buffer being 
    *          deallocated from memory
    */
   ~Queue();
 
   /**
-   * Retrieves the current number of Nodes in this Queue
+   * Retrieves the current number of entries in this Queue
    *
    * @pre     Queue must be initialized, which will also initialize
    *          the retrieved class member currentSize
    *
    * @post    state of this Queue does not change
    *
-   * @return  the number of Nodes in this Queue
+   * @return  the number of entries in this Queue
    */
   int getCurrentSize() const;
 
   /**
-   * Determines if the number of Nodes in this Queue is zero
+   * Determines if the number of entries in this Queue is zero
    *
    * @pre     Queue must be initialized, which will also initialize
    *          the retrieved class member currentSize
    *
    * @post    state of this Queue does not change
    *
-   * @return  true if the number of Nodes in this Queue
+   * @return  true if the number of entries in this Queue
    *          is zero, false otherwise
    */
   bool isEmpty() const; 
 
   /**
-   * Removes all entries from this Queue by sequentially deallocating
-   * memory from each Node existing in this Queue
+   * Removes all entries from this Queue by destroying each entry 
+   * and deallocating the buffer of this Queue
    *
    * @pre     Queue must be initialized, which will also initialize
-   *          manipulated class members head, tail, and currentSize
+   *          manipulated class members items, capacity, frontIndex 
+   *          and currentSize
    *
-   * @post    this Queue will have no Nodes (is empty) and class 
+   * @post    this Queue will have no entries (is empty) and class 
    *          member currentSize will be set to 0
    */
   void clear();
 
    /**
-   * Adds Node to the back of this Queue
+   * Ensures this Queue can hold at least the specified number of
+   * entries without allocating memory again
+   *
+   * @pre                Queue must be initialized
+   *
+   * @post               If successful, capacity of this Queue is at 
+   *                     least newCapacity with entries unchanged. No
+   *                     change in object state if unsuccessful.
+   * 
+   * @param newCapacity  number of entries to make room for
+   * 
+   * @return             true if this Queue can hold newCapacity 
+   *                     entries, false otherwise
+   */
+  bool reserve(int newCapacity);
+
+  /**
+   * Retrieves the number of entries this Queue can hold without 
+   * allocating memory again
+   *
+   * @pre     Queue must be initialized
+   *
+   * @post    state of this Queue does not change
+   *
+   * @return  the capacity of this Queue
+   */
+  int getCapacity() const;
+
+   /**
+   * Adds a copy of entry to the back of this Queue, growing the 
+   * buffer if it is full
    *
    * @pre            Queue must be initialized, which will also 
-   *                 initialize manipulated class members, tail, and
-   *                 currentSize
+   *                 initialize manipulated class members items, 
+   *                 capacity and currentSize
    *
-   * @post           If successful, new Node is added to the tail, 
+   * @post           If successful, new entry is added to the back, 
    *                 size of this Queue increases by 1. No change is
    *                 object state if unsuccessful.
    * 
    * @param anEntry  value to add to the end of this Queue
    * 
-   * @return         true if the head Node is successfully added to
+   * @return         true if the entry is successfully added to
    *                 this Queue, false otherwise
    */
-  bool push(T anEntry);
+  bool push(const T& anEntry);
 
    /**
-   * Removes head Node from this Queue and shifts all downstream 
-   * Nodes up
+   * Moves entry to the back of this Queue, growing the buffer if it
+   * is full
+   *
+   * @pre            Queue must be initialized
+   *
+   * @post           If successful, new entry is added to the back, 
+   *                 size of this Queue increases by 1. No change is
+   *                 object state if unsuccessful.
+   * 
+   * @param anEntry  value to move to the end of this Queue
+   * 
+   * @return         true if the entry is successfully added to
+   *                 this Queue, false otherwise
+   */
+  bool push(T&& anEntry);
+
+   /**
+   * Constructs an entry in place at the back of this Queue, growing
+   * the buffer if it is full
+   *
+   * @pre            Queue must be initialized
+   *
+   * @post           If successful, new entry is added to the back, 
+   *                 size of this Queue increases by 1. No change is
+   *                 object state if unsuccessful.
+   * 
+   * @param args     arguments passed to the constructor of T
+   * 
+   * @return         true if the entry is successfully added to
+   *                 this Queue, false otherwise
+   */
+  template<class... Args>
+  bool emplace(Args&&... args);
+
+   /**
+   * Removes front entry from this Queue
    *
    * @pre     Queue must be initialized, which will also initialize
-   *          manipulated class members head, tail, and currentSize
+   *          manipulated class members items, frontIndex, and 
+   *          currentSize
    *
-   * @post    If successful, head Node is deleted, size of this Queue
-   *          decreases by 1 and all downstream Nodes are shifted up 
-   *          by one. No change is object state if unsuccessful.
+   * @post    If successful, front entry is destroyed, size of this 
+   *          Queue decreases by 1 and the next entry becomes the 
+   *          front. No change is object state if unsuccessful.
    * 
-   * @return  true if the head Node is successfully removed from this 
-   *          Queue, false otherwise
+   * @return  true if the front entry is successfully removed from 
+   *          this Queue, false otherwise
    */
   bool pop();
 
    /**
-   * Retrieves value from the Node at the front of this Queue
+   * Retrieves value from the front of this Queue
    *
    * @pre     Queue must be initialized, which will also initialize
-   *          retrieved class member head
+   *          retrieved class members items and frontIndex
    *
    * @post    state of this Queue does not change
    * 
-   * @return  value from front Node
+   * @return  reference to the value at the front
    */
-  T front() const;
+  T& front();
+  const T& front() const;
 
    /**
-   * Retrieves value from the Node at the back of this Queue
+   * Retrieves value from the back of this Queue
    *
    * @pre     Queue must be initialized, which will also initialize
-   *          retrieved class member tail
+   *          retrieved class members items, frontIndex and 
+   *          currentSize
    *
    * @post    state of this Queue does not change
    * 
-   * @return  value from back Node
+   * @return  reference to the value at the back
    */
-  T back() const;
+  T& back();
+  const T& back() const;
 
    /**
    * Displays contents of this Queue through the output stream
    *
    * @pre     Queue must be initialized, which will also initialize
-   *          retrieved class member head, tail, and currentSize
+   *          retrieved class members items, frontIndex, and 
+   *          currentSize
    *
    * @post    state of this Queue does not change
    */
   void printList();
 
+  /**
+   * Retrieves an iterator at the front entry of this Queue
+   *
+   * @pre     Queue must be initialized
+   *
+   * @post    state of this Queue does not change
+   *
+   * @return  iterator at the front entry
+   */
+  const_iterator begin() const;
+
+  /**
+   * Retrieves an iterator one past the back entry of this Queue
+   *
+   * @pre     Queue must be initialized
+   *
+   * @post    state of this Queue does not change
+   *
+   * @return  iterator past the back entry
+   */
+  const_iterator end() const;
+
 protected:
-  /** The current number of Nodes in this Queue. */
+  /**
+   * Moves the entries of this Queue into a new buffer of the 
+   * specified capacity, in order, starting at index 0
+   *
+   * @pre                Queue must be initialized and newCapacity
+   *                     must be at least currentSize
+   *
+   * @post               If successful, entries are stored in the new
+   *                     buffer and the old buffer is deallocated. No
+   *                     change in object state if unsuccessful.
+   *
+   * @param newCapacity  number of entries the new buffer holds
+   *
+   * @return             true if the new buffer was allocated, false
+   *                     otherwise
+   */
+  bool reallocate(int newCapacity);
+
+  /**
+   * Allocates a buffer of the specified capacity
+   *
+   * @param newCapacity  number of entries the buffer holds
+   *
+   * @return             the buffer, or nullptr if memory could not
+   *                     be allocated
+   */
+  T* allocateItems(int newCapacity);
+
+  /**
+   * Moves the entries of this Queue into the specified buffer, in 
+   * order, starting at index 0, and deallocates the old buffer
+   *
+   * @pre                newItems holds newCapacity entries and 
+   *                     newCapacity is at least currentSize
+   *
+   * @post               entries are stored in newItems
+   *
+   * @param newItems     buffer receiving the entries
+   * @param newCapacity  number of entries newItems holds
+   */
+  void adoptItems(T* newItems, int newCapacity);
+
+  /**
+   * Retrieves the buffer index of the entry at the specified 
+   * position from the front of this Queue
+   *
+   * @pre               Queue must be initialized with a buffer
+   *
+   * @post              state of this Queue does not change
+   *
+   * @param  position   number of entries from the front
+   *
+   * @return            index into items
+   */
+  int indexOf(int position) const;
+
+  typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+  /** Allocator providing the buffer of this Queue. */
+  Allocator allocator;
+  /** The current number of entries in this Queue. */
   int currentSize;
-  /** Reference to the address of the first Node in this Queue, 
-   * otherwise nullptr. */
-  Node<T> *head;
-  /** Reference to the address of the last Node in this Queue, 
-   * otherwise nullptr. */
-  Node<T> *tail;
-}; // end Queue.h
\ No newline at end of file
+  /** Number of entries the buffer can hold. */
+  int capacity;
+  /** Buffer index of the front entry of this Queue. */
+  int frontIndex;
+  /** Reference to the address of the buffer holding the entries of
+   * this Queue, otherwise nullptr. */
+  T *items;
+};
+
+/**
+ * Default constructor for this Queue class. Initializes an empty
+ * Queue.
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue() : 
+   currentSize(0), capacity(0), frontIndex(0), items(nullptr) {}
+
+/**
+ * Constructor for this Queue class. Initializes an empty Queue 
+ * that obtains its buffer from the specified Allocator.
+ * 
+ * @param   allocator   Allocator providing memory for entries
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(const Allocator& allocator) : 
+   allocator(allocator), currentSize(0), capacity(0), frontIndex(0), 
+   items(nullptr) {}
+
+/**
+ * Copy constructor for this Queue class
+ * 
+ * @param   otherQueue  values from another Queue to be deep copied
+ *                      to this Queue
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(const Queue& otherQueue) : 
+   allocator(AllocatorTraits::select_on_container_copy_construction(
+      otherQueue.allocator)),
+   currentSize(0), capacity(0), frontIndex(0), items(nullptr) {
+
+   // create empty Queue if otherQueue is empty
+   if (otherQueue.currentSize == 0) {
+      return;
+   }
+
+   // deep copy values from otherQueue into a buffer of exact size
+   if (!reserve(otherQueue.currentSize)) {
+      throw std::bad_alloc();
+   }
+
+   for (int i = 0; i < otherQueue.currentSize; i++) {
+      AllocatorTraits::construct(allocator, &items[i], 
+         otherQueue.items[otherQueue.indexOf(i)]);
+      currentSize++;
+   }
+}
+
+/**
+ * Move constructor for this Queue class, which takes over the 
+ * buffer of another Queue in constant time
+ * 
+ * @param   otherQueue  Queue whose entries are moved to this Queue;
+ *                      left empty
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(Queue&& otherQueue) noexcept :
+   allocator(std::move(otherQueue.allocator)),
+   currentSize(otherQueue.currentSize), capacity(otherQueue.capacity),
+   frontIndex(otherQueue.frontIndex), items(otherQueue.items) {
+
+   otherQueue.items = nullptr;
+   otherQueue.capacity = 0;
+   otherQueue.frontIndex = 0;
+   otherQueue.currentSize = 0;
+}
+
+/**
+ * Copy assignment operator for this Queue class
+ *
+ * @pre                 Queue must be initialized
+ *
+ * @post                this Queue holds copies of the entries of
+ *                      otherQueue, in order
+ * 
+ * @param   otherQueue  values from another Queue to be deep copied
+ *                      to this Queue
+ *
+ * @return              this Queue
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>& Queue<T, Allocator>::operator=(
+   const Queue& otherQueue) {
+
+   if (this == &otherQueue) {
+      return *this;
+   }
+
+   // the old buffer must go back to the allocator that provided it
+   clear();
+   if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+      allocator = otherQueue.allocator;
+   }
+
+   if (!reserve(otherQueue.currentSize)) {
+      throw std::bad_alloc();
+   }
+   for (const T& entry : otherQueue) {
+      AllocatorTraits::construct(allocator, &items[currentSize], entry);
+      currentSize++;
+   }
+   return *this;
+}
+
+/**
+ * Move assignment operator for this Queue class, which takes over
+ * the buffer of another Queue in constant time when the allocators
+ * allow it
+ *
+ * @pre                 Queue must be initialized
+ *
+ * @post                this Queue holds the entries of otherQueue, 
+ *                      which is left empty
+ * 
+ * @param   otherQueue  Queue whose entries are moved to this Queue
+ *
+ * @return              this Queue
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>& Queue<T, Allocator>::operator=(Queue&& otherQueue)
+   noexcept(std::allocator_traits<Allocator>::
+      propagate_on_container_move_assignment::value) {
+
+   if (this == &otherQueue) {
+      return *this;
+   }
+   clear();
+
+   if constexpr (AllocatorTraits::propagate_on_container_move_assignment
+      ::value) {
+      allocator = std::move(otherQueue.allocator);
+   }
+   else if (!(allocator == otherQueue.allocator)) {
+      // a buffer from another allocator cannot be taken over, so the
+      // entries are moved one by one
+      if (!reserve(otherQueue.currentSize)) {
+         throw std::bad_alloc();
+      }
+      for (int i = 0; i < otherQueue.currentSize; i++) {
+         AllocatorTraits::construct(allocator, &items[i], 
+            std::move(otherQueue.items[otherQueue.indexOf(i)]));
+         currentSize++;
+      }
+      otherQueue.clear();
+      return *this;
+   }
+
+   items = otherQueue.items;
+   capacity = otherQueue.capacity;
+   frontIndex = otherQueue.frontIndex;
+   currentSize = otherQueue.currentSize;
+
+   otherQueue.items = nullptr;
+   otherQueue.capacity = 0;
+   otherQueue.frontIndex = 0;
+   otherQueue.currentSize = 0;
+   return *this;
+}
+
+/**
+ * Exchanges the entries of this Queue with those of another Queue
+ * in constant time
+ *
+ * @pre                 both Queues must be initialized with equal
+ *                      allocators, unless the allocators propagate
+ *                      on swap
+ *
+ * @post                each Queue holds the entries of the other
+ * 
+ * @param   otherQueue  Queue to exchange entries with
+ */
+template<class T, class Allocator>
+void Queue<T, Allocator>::swap(Queue& otherQueue) noexcept {
+   if (AllocatorTraits::propagate_on_container_swap::value) {
+      std::swap(allocator, otherQueue.allocator);
+   }
+   std::swap(items, otherQueue.items);
+   std::swap(capacity, otherQueue.capacity);
+   std::swap(frontIndex, otherQueue.frontIndex);
+   std::swap(currentSize, otherQueue.currentSize);
+}
+
+/**
+ * Destructor for this Queue class that destroys this Queue
+ * and frees memory allocated by the object.
+ *
+ * Calls Queue::clear() method.
+ *
+ * @pre     Queue must be initialized
+ *
+ * @post    this Queue is destructed with its buffer being 
+ *          deallocated from memory
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::~Queue() {
+   clear(); 
+}
+
+/**
+ * Retrieves the current number of entries in this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          the retrieved class member currentSize
+ *
+ * @post    state of this Queue does not change
+ *
+ * @return  the number of entries in this Queue
+ */
+template<class T, class Allocator>
+int Queue<T, Allocator>::getCurrentSize() const { 
+   return currentSize; 
+}
+
+/**
+ * Determines if the number of entries in this Queue is zero
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          the retrieved class member currentSize
+ *
+ * @post    state of this Queue does not change
+ *
+ * @return  true if the number of entries in this Queue
+ *          is zero, false otherwise
+ */
+template<class T, class Allocator>
+bool Queue<T, Allocator>::isEmpty() const {
+  if (currentSize == 0) {
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Removes all entries from this Queue by destroying each entry 
+ * and deallocating the buffer of this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          manipulated class members items, capacity, frontIndex 
+ *          and currentSize
+ *
+ * @post    this Queue will have no entries (is empty) and class 
+ *          member currentSize will be set to 0
+ */
+template<class T, class Allocator>
+void Queue<T, Allocator>::clear() {
+  // destroy entries in this Queue if not empty
+  for (int i = 0; i < currentSize; i++) {
+    AllocatorTraits::destroy(allocator, &items[indexOf(i)]);
+  }
+
+  // return the buffer to the allocator
+  if (items != nullptr) {
+    AllocatorTraits::deallocate(allocator, items, capacity);
+  }
+
+  // reset this Queue to starting conditions (empty list)
+  items = nullptr;
+  capacity = 0;
+  frontIndex = 0;
+  currentSize = 0;
+}
+
+/**
+ * Ensures this Queue can hold at least the specified number of
+ * entries without allocating memory again
+ *
+ * @pre                Queue must be initialized
+ *
+ * @post               If successful, capacity of this Queue is at 
+ *                     least newCapacity with entries unchanged. No
+ *                     change in object state if unsuccessful.
+ * 
+ * @param newCapacity  number of entries to make room for
+ * 
+ * @return             true if this Queue can hold newCapacity 
+ *                     entries, false otherwise
+ */
+template<class T, class Allocator>
+bool Queue<T, Allocator>::reserve(int newCapacity) {
+   if (newCapacity <= capacity) {
+      return true;
+   }
+   return reallocate(newCapacity);
+}
+
+/**
+ * Retrieves the number of entries this Queue can hold without 
+ * allocating memory again
+ *
+ * @pre     Queue must be initialized
+ *
+ * @post    state of this Queue does not change
+ *
+ * @return  the capacity of this Queue
+ */
+template<class T, class Allocator>
+int Queue<T, Allocator>::getCapacity() const {
+   return capacity;
+}
+
+/**
+* Adds a copy of entry to the back of this Queue, growing the 
+* buffer if it is full
+*
+* @pre            Queue must be initialized, which will also 
+*                 initialize manipulated class members items, 
+*                 capacity and currentSize
+*
+* @post           If successful, new entry is added to the back, 
+*                 size of this Queue increases by 1. No change is
+*                 object state if unsuccessful.
+* 
+* @param anEntry  value to add to the end of this Queue
+* 
+* @return         true if the entry is successfully added to
+*                 this Queue, false otherwise
+*/
+template<class T, class Allocator>
+bool Queue<T, Allocator>::push(const T& newEntry) {
+   return emplace(newEntry);
+}
+
+/**
+* Moves entry to the back of this Queue, growing the buffer if it
+* is full
+*
+* @pre            Queue must be initialized
+*
+* @post           If successful, new entry is added to the back, 
+*                 size of this Queue increases by 1. No change is
+*                 object state if unsuccessful.
+* 
+* @param anEntry  value to move to the end of this Queue
+* 
+* @return         true if the entry is successfully added to
+*                 this Queue, false otherwise
+*/
+template<class T, class Allocator>
+bool Queue<T, Allocator>::push(T&& newEntry) {
+   return emplace(std::move(newEntry));
+}
+
+/**
+* Constructs an entry in place at the back of this Queue, growing
+* the buffer if it is full
+*
+* @pre            Queue must be initialized
+*
+* @post           If successful, new entry is added to the back, 
+*                 size of this Queue increases by 1. No change is
+*                 object state if unsuccessful.
+* 
+* @param args     arguments passed to the constructor of T
+* 
+* @return         true if the entry is successfully added to
+*                 this Queue, false otherwise
+*/
+template<class T, class Allocator>
+template<class... Args>
+bool Queue<T, Allocator>::emplace(Args&&... args) {
+   if (currentSize < capacity) {
+      AllocatorTraits::construct(allocator, 
+         &items[indexOf(currentSize)], std::forward<Args>(args)...);
+      currentSize++;
+      return true;
+   }
+
+   // double the buffer when full so pushes stay amortized O(1), 
+   // stopping at the largest int capacity
+   const int maxCapacity = std::numeric_limits<int>::max();
+   if (capacity == maxCapacity) {
+      return false;
+   }
+   int newCapacity = capacity < 8 ? 16 : 
+      capacity > maxCapacity / 2 ? maxCapacity : capacity * 2;
+
+   T* newItems = allocateItems(newCapacity);
+   if (newItems == nullptr) {
+      return false;
+   }
+
+   // the arguments may refer to an entry of this Queue, as in 
+   // q.push(q.front()), so the new entry is constructed before the
+   // old entries are moved out of their buffer
+   try {
+      AllocatorTraits::construct(allocator, &newItems[currentSize],
+         std::forward<Args>(args)...);
+   }
+   catch (...) {
+      AllocatorTraits::deallocate(allocator, newItems, newCapacity);
+      throw;
+   }
+
+   adoptItems(newItems, newCapacity);
+   currentSize++;
+   return true;
+}
+
+/**
+ * Removes front entry from this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          manipulated class members items, frontIndex, and 
+ *          currentSize
+ *
+ * @post    If successful, front entry is destroyed, size of this 
+ *          Queue decreases by 1 and the next entry becomes the 
+ *          front. No change is object state if unsuccessful.
+ * 
+ * @return  true if the front entry is successfully removed from 
+ *          this Queue, false otherwise
+ */
+template<class T, class Allocator>
+bool Queue<T, Allocator>::pop() {
+   
+   if (currentSize > 0) {
+      AllocatorTraits::destroy(allocator, &items[frontIndex]);
+      currentSize--;
+
+      // advance the front, wrapping around the end of the buffer
+      frontIndex = currentSize == 0 ? 0 : indexOf(1);
+      return true;
+   }
+   return false;
+}
+
+/**
+ * Retrieves value from the front of this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          retrieved class members items and frontIndex
+ *
+ * @post    state of this Queue does not change
+ * 
+ * @return  reference to the value at the front
+ */
+template<class T, class Allocator>
+T& Queue<T, Allocator>::front() {
+   if (isEmpty())
+   {
+      std::cout << "Cannot peek at the front of an empty queue.\
+         Program terminated";
+      exit(EXIT_FAILURE);
+   }
+   return items[frontIndex];
+}
+
+/**
+ * Retrieves value from the front of this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          retrieved class members items and frontIndex
+ *
+ * @post    state of this Queue does not change
+ * 
+ * @return  reference to the value at the front
+ */
+template<class T, class Allocator>
+const T& Queue<T, Allocator>::front() const {
+   if (isEmpty())
+   {
+      std::cout << "Cannot peek at the front of an empty queue.\
+         Program terminated";
+      exit(EXIT_FAILURE);
+   }
+   return items[frontIndex];
+}
+
+/**
+ * Retrieves value from the back of this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          retrieved class members items, frontIndex and 
+ *          currentSize
+ *
+ * @post    state of this Queue does not change
+ * 
+ * @return  reference to the value at the back
+ */
+template<class T, class Allocator>
+T& Queue<T, Allocator>::back() {
+   if (isEmpty())
+   {
+      std::cout << "Cannot peek at the back of an empty queue.\
+         Program terminated";
+      exit(EXIT_FAILURE);
+   }
+   return items[indexOf(currentSize - 1)];
+}
+
+/**
+ * Retrieves value from the back of this Queue
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          retrieved class members items, frontIndex and 
+ *          currentSize
+ *
+ * @post    state of this Queue does not change
+ * 
+ * @return  reference to the value at the back
+ */
+template<class T, class Allocator>
+const T& Queue<T, Allocator>::back() const {
+   if (isEmpty())
+   {
+      std::cout << "Cannot peek at the back of an empty queue.\
+         Program terminated";
+      exit(EXIT_FAILURE);
+   }
+   return items[indexOf(currentSize - 1)];
+}
+
+/**
+ * Displays contents of this Queue through the output stream
+ *
+ * @pre     Queue must be initialized, which will also initialize
+ *          retrieved class members items, frontIndex, and 
+ *          currentSize
+ *
+ * @post    state of this Queue does not change
+ */
+template<class T, class Allocator>
+void Queue<T, Allocator>::printList(){
+   std::cout << "[";
+
+	for (int i = 0; i < currentSize; i++){
+      // print data stored at each entry
+		std::cout << items[indexOf(i)];
+
+      // print a comma unless at the end of the list
+		if (i + 1 < currentSize){
+			std::cout << ","; 
+		}
+	}
+	std::cout << "]";
+}
+
+/**
+ * Retrieves an iterator at the front entry of this Queue
+ *
+ * @pre     Queue must be initialized
+ *
+ * @post    state of this Queue does not change
+ *
+ * @return  iterator at the front entry
+ */
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_iterator 
+Queue<T, Allocator>::begin() const {
+   return const_iterator(this, 0);
+}
+
+/**
+ * Retrieves an iterator one past the back entry of this Queue
+ *
+ * @pre     Queue must be initialized
+ *
+ * @post    state of this Queue does not change
+ *
+ * @return  iterator past the back entry
+ */
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_iterator 
+Queue<T, Allocator>::end() const {
+   return const_iterator(this, currentSize);
+}
+
+/**
+ * Moves the entries of this Queue into a new buffer of the 
+ * specified capacity, in order, starting at index 0
+ *
+ * @pre                Queue must be initialized and newCapacity
+ *                     must be at least currentSize
+ *
+ * @post               If successful, entries are stored in the new
+ *                     buffer and the old buffer is deallocated. No
+ *                     change in object state if unsuccessful.
+ *
+ * @param newCapacity  number of entries the new buffer holds
+ *
+ * @return             true if the new buffer was allocated, false
+ *                     otherwise
+ */
+template<class T, class Allocator>
+bool Queue<T, Allocator>::reallocate(int newCapacity) {
+   T* newItems = allocateItems(newCapacity);
+   if (newItems == nullptr) {
+      return false;
+   }
+
+   adoptItems(newItems, newCapacity);
+   return true;
+}
+
+/**
+ * Allocates a buffer of the specified capacity
+ *
+ * @param newCapacity  number of entries the buffer holds
+ *
+ * @return             the buffer, or nullptr if memory could not
+ *                     be allocated
+ */
+template<class T, class Allocator>
+T* Queue<T, Allocator>::allocateItems(int newCapacity) {
+   // inability to allocate memory will throw a std::bad_alloc error
+   // which will be caught and signals a lack of success
+   try {
+      return AllocatorTraits::allocate(allocator, newCapacity);
+   }
+   catch (std::bad_alloc &exc) {
+      return nullptr;
+   }
+}
+
+/**
+ * Moves the entries of this Queue into the specified buffer, in 
+ * order, starting at index 0, and deallocates the old buffer
+ *
+ * @pre                newItems holds newCapacity entries and 
+ *                     newCapacity is at least currentSize
+ *
+ * @post               entries are stored in newItems
+ *
+ * @param newItems     buffer receiving the entries
+ * @param newCapacity  number of entries newItems holds
+ */
+template<class T, class Allocator>
+void Queue<T, Allocator>::adoptItems(T* newItems, int newCapacity) {
+   // unwrap the circular buffer into the front of the new buffer
+   for (int i = 0; i < currentSize; i++) {
+      T& oldItem = items[indexOf(i)];
+      AllocatorTraits::construct(allocator, &newItems[i], 
+         std::move_if_noexcept(oldItem));
+      AllocatorTraits::destroy(allocator, &oldItem);
+   }
+
+   if (items != nullptr) {
+      AllocatorTraits::deallocate(allocator, items, capacity);
+   }
+   items = newItems;
+   capacity = newCapacity;
+   frontIndex = 0;
+}
+
+/**
+ * Retrieves the buffer index of the entry at the specified 
+ * position from the front of this Queue
+ *
+ * @pre               Queue must be initialized with a buffer
+ *
+ * @post              state of this Queue does not change
+ *
+ * @param  position   number of entries from the front
+ *
+ * @return            index into items
+ */
+template<class T, class Allocator>
+int Queue<T, Allocator>::indexOf(int position) const {
+   int index = frontIndex + position;
+   return index < capacity ? index : index - capacity;
+}
+// end Queue.h
@@ -0,0 +1,218 @@
+/**
+ * Rasterizer.cpp
+ *
+ * Implementations for the Rasterizer class, which draws a Koch curve
+ * straight into an 8 bit grayscale pixel buffer, band by band on
+ * separate threads.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include "PngEncoder.h"
+#include "Rasterizer.h"
+#include "ThreadPool.h"
+
+namespace {
+   /** width of the letter page in points */
+   const double PAGE_WIDTH = 612;
+   /** height of the letter page in points */
+   const double PAGE_HEIGHT = 792;
+   /** points per inch */
+   const double POINTS_PER_INCH = 72;
+   /** number of bands per thread, so that uneven bands balance out */
+   const int BANDS_PER_THREAD = 4;
+   /** gray level of the curve */
+   const unsigned char INK = 0;
+   /** gray level of the background */
+   const unsigned char PAPER = 255;
+}
+
+/**
+ * Constructor for Rasterizer class, which draws the curve
+ *
+ * @pre                    dotsPerInch and threadCount are positive
+ *
+ * @post                   pixels hold the drawn curve
+ *
+ * @param   generator      KochGenerator describing the curve
+ * @param   dotsPerInch    resolution of the image
+ * @param   threadCount    number of threads drawing bands
+ */
+Rasterizer::Rasterizer(const KochGenerator& generator, int dotsPerInch,
+   int threadCount) {
+
+   if (dotsPerInch < 1) {
+      throw std::invalid_argument("Resolution must be at least 1 dpi");
+   }
+
+   scale = dotsPerInch / POINTS_PER_INCH;
+   width = (int) std::lround(PAGE_WIDTH * scale);
+   height = (int) std::lround(PAGE_HEIGHT * scale);
+   pixels.assign((std::size_t) width * height, PAPER);
+
+   Point start = generator.getFirstPoint();
+   Point end = generator.getLastPoint();
+   int level = generator.getCurveLevel();
+
+   int bandCount = std::min(height, threadCount * BANDS_PER_THREAD);
+   if (threadCount <= 1) {
+      drawBand(start, end, level, 0, height);
+      return;
+   }
+
+   // bands hold disjoint rows, so they are drawn without locking
+   ThreadPool pool(threadCount);
+   for (int band = 0; band < bandCount; band++) {
+      int firstRow = (int) ((long long) height * band / bandCount);
+      int lastRow = (int) ((long long) height * (band + 1) / bandCount);
+
+      pool.submit([this, start, end, level, firstRow, lastRow]() {
+         drawBand(start, end, level, firstRow, lastRow);
+      });
+   }
+   pool.wait();
+}
+
+/**
+ * Retrieves the width of the image
+ *
+ * @return  width in pixels
+ */
+int Rasterizer::getWidth() const {
+   return width;
+}
+
+/**
+ * Retrieves the height of the image
+ *
+ * @return  height in pixels
+ */
+int Rasterizer::getHeight() const {
+   return height;
+}
+
+/**
+ * Retrieves the gray level of a pixel
+ *
+ * @param   column   column of the pixel, from the left
+ * @param   row      row of the pixel, from the top
+ *
+ * @return           0 for curve pixels, 255 for background
+ */
+unsigned char Rasterizer::getPixel(int column, int row) const {
+   return pixels[(std::size_t) row * width + column];
+}
+
+/**
+ * Writes the image in binary PGM format
+ *
+ * @param   output   output stream to write the image to
+ */
+void Rasterizer::writePgm(std::ostream& output) const {
+   std::string header = "P5\n" + std::to_string(width) + " " +
+      std::to_string(height) + "\n255\n";
+
+   output.write(header.data(), header.size());
+   output.write((const char*) pixels.data(), pixels.size());
+   output.flush();
+}
+
+/**
+ * Writes the image in PNG format
+ *
+ * @param   output   output stream to write the image to
+ */
+void Rasterizer::writePng(std::ostream& output) const {
+   ::writePng(output, width, height, pixels.data());
+}
+
+/**
+ * Draws the parts of a Koch curve that reach the rows of a band
+ *
+ * @param   start      first point of the curve
+ * @param   end        last point of the curve
+ * @param   level      Koch level of the curve
+ * @param   firstRow   first row of the band
+ * @param   lastRow    row following the band
+ */
+void Rasterizer::drawBand(const Point& start, const Point& end,
+   int level, int firstRow, int lastRow) {
+
+   double length = std::hypot(end.getXCoord() - start.getXCoord(),
+      end.getYCoord() - start.getYCoord());
+
+   // the curve stays within half its length of its midpoint
+   double middle = (PAGE_HEIGHT -
+      (start.getYCoord() + end.getYCoord()) / 2) * scale;
+   double reach = length / 2 * scale + 1;
+   if (middle + reach < firstRow || middle - reach > lastRow) {
+      return;
+   }
+
+   // below a pixel the curve cannot be told apart from a line
+   if (level == 0 || length * scale < 1) {
+      drawSegment(start, end, firstRow, lastRow);
+      return;
+   }
+
+   Point firstThird, tip, secondThird;
+   start.kochStep(end, firstThird, tip, secondThird);
+
+   drawBand(start, firstThird, level - 1, firstRow, lastRow);
+   drawBand(firstThird, tip, level - 1, firstRow, lastRow);
+   drawBand(tip, secondThird, level - 1, firstRow, lastRow);
+   drawBand(secondThird, end, level - 1, firstRow, lastRow);
+}
+
+/**
+ * Draws the pixels of a straight segment that lie in a band
+ *
+ * @param   start      first point of the segment
+ * @param   end        last point of the segment
+ * @param   firstRow   first row of the band
+ * @param   lastRow    row following the band
+ */
+void Rasterizer::drawSegment(const Point& start, const Point& end,
+   int firstRow, int lastRow) {
+
+   // pixel coordinates count rows down from the top of the page
+   double startColumn = start.getXCoord() * scale;
+   double startRow = (PAGE_HEIGHT - start.getYCoord()) * scale;
+   double columns = end.getXCoord() * scale - startColumn;
+   double rows = (PAGE_HEIGHT - end.getYCoord()) * scale - startRow;
+
+   // one step per pixel along the longer axis
+   long long steps = (long long) std::ceil(std::max(std::fabs(columns),
+      std::fabs(rows)));
+   if (steps < 1) {
+      steps = 1;
+   }
+
+   // only visit the steps that can land in the band
+   long long firstStep = 0;
+   long long lastStep = steps;
+   if (rows != 0) {
+      double enter = (firstRow - 0.5 - startRow) / rows * steps;
+      double leave = (lastRow - 0.5 - startRow) / rows * steps;
+      if (enter > leave) {
+         std::swap(enter, leave);
+      }
+      firstStep = std::max(firstStep, (long long) std::floor(enter));
+      lastStep = std::min(lastStep, (long long) std::ceil(leave));
+   }
+
+   for (long long step = firstStep; step <= lastStep; step++) {
+      double fraction = (double) step / steps;
+      long column = std::lround(startColumn + columns * fraction);
+      long row = std::lround(startRow + rows * fraction);
+
+      if (row >= firstRow && row < lastRow && column >= 0 &&
+         column < width) {
+         pixels[(std::size_t) row * width + column] = INK;
+      }
+   }
+} // end Rasterizer.cpp
@@ -0,0 +1,110 @@
+/**
+ * Rasterizer.h
+ *
+ * Declarations for the Rasterizer class, which draws a Koch curve
+ * straight into an 8 bit grayscale pixel buffer, without formatting
+ * any vector output. The image covers the 612 x 792 point letter
+ * page PostScript draws on at the given resolution. It is split into
+ * horizontal bands that are drawn on separate threads; each band
+ * expands only the parts of the curve that can reach it, and stops
+ * expanding segments shorter than a pixel.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include "KochGenerator.h"
+#include "Point.h"
+
+/**
+ * Represents a Koch curve drawn into a pixel buffer
+ */
+class Rasterizer {
+public:
+   /**
+    * Constructor for Rasterizer class, which draws the curve
+    *
+    * @pre                    dotsPerInch and threadCount are positive
+    *
+    * @post                   pixels hold the drawn curve
+    *
+    * @param   generator      KochGenerator describing the curve
+    * @param   dotsPerInch    resolution of the image
+    * @param   threadCount    number of threads drawing bands
+    */
+   Rasterizer(const KochGenerator& generator, int dotsPerInch,
+      int threadCount);
+
+   /**
+    * Retrieves the width of the image
+    *
+    * @return  width in pixels
+    */
+   int getWidth() const;
+
+   /**
+    * Retrieves the height of the image
+    *
+    * @return  height in pixels
+    */
+   int getHeight() const;
+
+   /**
+    * Retrieves the gray level of a pixel
+    *
+    * @param   column   column of the pixel, from the left
+    * @param   row      row of the pixel, from the top
+    *
+    * @return           0 for curve pixels, 255 for background
+    */
+   unsigned char getPixel(int column, int row) const;
+
+   /**
+    * Writes the image in binary PGM format
+    *
+    * @param   output   output stream to write the image to
+    */
+   void writePgm(std::ostream& output) const;
+
+   /**
+    * Writes the image in PNG format
+    *
+    * @param   output   output stream to write the image to
+    */
+   void writePng(std::ostream& output) const;
+
+private:
+   /**
+    * Draws the parts of a Koch curve that reach the rows of a band
+    *
+    * @param   start      first point of the curve
+    * @param   end        last point of the curve
+    * @param   level      Koch level of the curve
+    * @param   firstRow   first row of the band
+    * @param   lastRow    row following the band
+    */
+   void drawBand(const Point& start, const Point& end, int level,
+      int firstRow, int lastRow);
+
+   /**
+    * Draws the pixels of a straight segment that lie in a band
+    *
+    * @param   start      first point of the segment
+    * @param   end        last point of the segment
+    * @param   firstRow   first row of the band
+    * @param   lastRow    row following the band
+    */
+   void drawSegment(const Point& start, const Point& end, int firstRow,
+      int lastRow);
+
+   /** pixels per point */
+   double scale;
+   /** width of the image in pixels */
+   int width;
+   /** height of the image in pixels */
+   int height;
+   /** gray levels of the pixels, row by row from the top */
+   std::vector<unsigned char> pixels;
+}; // end Rasterizer.h
@@ -0,0 +1,175 @@
+/**
+ * Shard.cpp
+ *
+ * Implementations for writing one contiguous slice (shard) of a Koch
+ * curve and for merging the shards of a curve into a .ps file.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "Shard.h"
+#include "PostScriptWriter.h"
+
+namespace {
+   /** first word of the line starting every shard */
+   const std::string SHARD_TAG = "%%KochShard";
+
+   /**
+    * Retrieves the index of the first point of the specified shard
+    *
+    * @param   count       number of points in the curve
+    * @param   shardIndex  index of the shard, up to shardCount
+    * @param   shardCount  number of shards
+    *
+    * @return              index of the first point of the shard
+    */
+   long long shardStart(long long count, int shardIndex, int shardCount) {
+      // spread the remainder over the first shards without computing
+      // count * shardIndex, which overflows for high levels
+      long long remainder = count % shardCount;
+      return (count / shardCount) * shardIndex +
+         (shardIndex < remainder ? shardIndex : remainder);
+   }
+}
+
+/**
+ * Writes the specified shard of a Koch curve. Shard i of N holds the
+ * points with indices in [count * i / N, count * (i + 1) / N), where
+ * count is the number of points in the curve; only that slice is
+ * generated. Lines are relative to the point preceding the slice,
+ * exactly as in the output of the whole curve.
+ *
+ * @pre                    0 <= shardIndex < shardCount
+ *
+ * @post                   shard is sent to the output stream
+ *
+ * @param   generator      KochGenerator describing the curve
+ * @param   shardIndex     index of the shard to write
+ * @param   shardCount     number of shards the curve is split into
+ * @param   output         output stream to write the shard to
+ */
+void writeShard(const KochGenerator& generator, int shardIndex,
+   int shardCount, std::ostream& output) {
+
+   int level = generator.getCurveLevel();
+   long long count = generator.getPointCount();
+   long long first = shardStart(count, shardIndex, shardCount);
+   long long last = shardStart(count, shardIndex + 1, shardCount);
+
+   // the end points are written exactly, so that merging compares
+   // the curves of shards as text
+   Point start = generator.getFirstPoint();
+   Point end = generator.getLastPoint();
+   std::ostringstream header;
+   header.precision(17);
+   header << SHARD_TAG << " " << shardIndex << " " << shardCount <<
+      " " << level << " " << start.getXCoord() << " " << 
+      start.getYCoord() << " " << end.getXCoord() << " " << 
+      end.getYCoord() << " " << generator.getRule().getName();
+   output << header.str() << std::endl;
+
+   PostScriptWriter writer(output, true);
+
+   if (first == last) {
+      return;
+   }
+   if (first == 0) {
+      // the first shard holds the moveto for the first point
+      writer.begin(generator.pointAt(0), level);
+      first++;
+   }
+   else {
+      writer.resume(generator.pointAt(first - 1), level);
+   }
+
+   generator.generateRange(first, last, writer);
+   writer.end();
+}
+
+/**
+ * Merges the shards of one Koch curve into a .ps file. Shards may be
+ * listed in any order, but every shard of the curve must be present
+ * exactly once.
+ *
+ * @pre                    files were written by writeShard for the
+ *                         same curve
+ *
+ * @post                   PostScript of the whole curve is sent to
+ *                         the output stream
+ *
+ * @param   paths          paths of the shard files
+ * @param   output         output stream to write PostScript to
+ *
+ * @throw   std::runtime_error if a shard is unreadable, malformed,
+ *          missing or belongs to another curve
+ */
+void mergeShards(const std::vector<std::string>& paths,
+   std::ostream& output) {
+
+   int shardCount = (int) paths.size();
+   if (shardCount == 0) {
+      throw std::runtime_error("No shards to merge");
+   }
+
+   std::vector<int> shardPaths(shardCount, -1);
+   // level, end points and rule of the curve, as the first shard 
+   // read names them
+   std::string curve;
+
+   // read the shard headers and order the files by shard index
+   for (int i = 0; i < shardCount; i++) {
+      std::ifstream shard(paths[i].c_str());
+      std::string header;
+
+      if (!shard || !std::getline(shard, header)) {
+         throw std::runtime_error("Cannot read shard " + paths[i]);
+      }
+
+      std::istringstream fields(header);
+      std::string tag;
+      int index = -1;
+      int count = 0;
+      std::string shardCurve;
+      int level;
+      double x1, y1, x2, y2;
+      std::string rule;
+
+      if (!(fields >> tag >> index >> count) || tag != SHARD_TAG ||
+         !std::getline(fields, shardCurve) ||
+         !(std::istringstream(shardCurve) >> level >> x1 >> y1 >> x2 >>
+         y2 >> rule)) {
+         throw std::runtime_error("Malformed shard " + paths[i]);
+      }
+      if (count != shardCount || index < 0 || index >= count ||
+         (!curve.empty() && shardCurve != curve)) {
+         throw std::runtime_error("Shard " + paths[i] +
+            " does not belong to this set of shards");
+      }
+      if (shardPaths[index] != -1) {
+         throw std::runtime_error("Shard " + paths[i] +
+            " is listed twice");
+      }
+
+      shardPaths[index] = i;
+      curve = shardCurve;
+   }
+
+   output << "%!PS-Adobe-2.0" << std::endl;
+
+   for (int i = 0; i < shardCount; i++) {
+      std::ifstream shard(paths[shardPaths[i]].c_str());
+      std::string header;
+      std::getline(shard, header);
+
+      // copy the lines of the shard in bulk
+      if (shard.peek() != std::char_traits<char>::eof()) {
+         output << shard.rdbuf();
+      }
+   }
+
+   output << "stroke" << std::endl;
+   output << "showpage" << std::endl;
+} // end Shard.cpp
@@ -0,0 +1,64 @@
+/**
+ * Shard.h
+ *
+ * Declarations for writing one contiguous slice (shard) of a Koch
+ * curve and for merging the shards of a curve into a .ps file. A
+ * shard starts with the line
+ *
+ *    %%KochShard <shard index> <shard count> <level> <x1> <y1> <x2> 
+ *       <y2> <rule>
+ *
+ * on one line, naming the curve by its level, end points and 
+ * generator rule, followed by the PostScript lines for the points of
+ * its slice, so that concatenating the shards in order yields the 
+ * lines of the whole curve. Only shards naming the same curve are 
+ * merged.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include "KochGenerator.h"
+
+/**
+ * Writes the specified shard of a Koch curve. Shard i of N holds the
+ * points with indices in [count * i / N, count * (i + 1) / N), where
+ * count is the number of points in the curve; only that slice is
+ * generated. Lines are relative to the point preceding the slice,
+ * exactly as in the output of the whole curve.
+ *
+ * @pre                    0 <= shardIndex < shardCount
+ *
+ * @post                   shard is sent to the output stream
+ *
+ * @param   generator      KochGenerator describing the curve
+ * @param   shardIndex     index of the shard to write
+ * @param   shardCount     number of shards the curve is split into
+ * @param   output         output stream to write the shard to
+ */
+void writeShard(const KochGenerator& generator, int shardIndex,
+   int shardCount, std::ostream& output);
+
+/**
+ * Merges the shards of one Koch curve into a .ps file. Shards may be
+ * listed in any order, but every shard of the curve must be present
+ * exactly once.
+ *
+ * @pre                    files were written by writeShard for the
+ *                         same curve
+ *
+ * @post                   PostScript of the whole curve is sent to
+ *                         the output stream
+ *
+ * @param   paths          paths of the shard files
+ * @param   output         output stream to write PostScript to
+ *
+ * @throw   std::runtime_error if a shard is unreadable, malformed,
+ *          missing or belongs to another curve
+ */
+void mergeShards(const std::vector<std::string>& paths,
+   std::ostream& output);
+// end Shard.h
@@ -0,0 +1,117 @@
+/**
+ * SvgWriter.cpp
+ *
+ * Implementations for the SvgWriter class, which writes the Points of
+ * a Koch curve to an output stream as an SVG path as they are
+ * received.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cmath>
+#include "SvgWriter.h"
+
+namespace {
+   /** height of the letter page in points */
+   const long PAGE_HEIGHT = 792;
+}
+
+/**
+ * Constructor for SvgWriter class
+ *
+ * @param   output   output stream to write SVG to
+ */
+SvgWriter::SvgWriter(std::ostream& output) :
+   buffer(output), output(output), absolute(false), priorXCoord(0),
+   priorYCoord(0) {}
+
+/**
+ * Writes the SVG header and the move to the first point
+ *
+ * @pre                 no Points have been added to this writer
+ *
+ * @post                header is sent to the output stream
+ *
+ * @param   firstPoint  first point of the Koch curve
+ * @param   level       Koch level of the curve
+ */
+void SvgWriter::begin(const Point& firstPoint, int level) {
+   buffer.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"612\""
+      " height=\"792\" viewBox=\"0 0 612 792\">\n"
+      "<path fill=\"none\" stroke=\"black\" stroke-width=\"1\" d=\"\n");
+
+   // SVG counts Y down from the top of the page
+   writeLine('M', std::lround(firstPoint.getXCoord()),
+      PAGE_HEIGHT - std::lround(firstPoint.getYCoord()));
+
+   absolute = level == 0;
+   priorXCoord = firstPoint.getXCoord();
+   priorYCoord = firstPoint.getYCoord();
+}
+
+/**
+ * Writes the line to the next Point of the Koch curve. Level 0
+ * curves are written with an absolute L, all other levels with a
+ * relative l from the prior Point.
+ *
+ * @pre              begin() has been called
+ *
+ * @post             line is sent to the output stream
+ *
+ * @param   point    next Point of the Koch curve
+ */
+void SvgWriter::addPoint(const Point& point) {
+   if (absolute) {
+      writeLine('L', std::lround(point.getXCoord()),
+         PAGE_HEIGHT - std::lround(point.getYCoord()));
+   }
+   else {
+      writeLine('l', std::lround(point.getXCoord() - priorXCoord),
+         -std::lround(point.getYCoord() - priorYCoord));
+   }
+
+   priorXCoord = point.getXCoord();
+   priorYCoord = point.getYCoord();
+}
+
+/**
+ * Writes the Z command that closes the path
+ *
+ * @pre     begin() has been called
+ *
+ * @post    line is sent to the output stream
+ */
+void SvgWriter::closePath() {
+   buffer.write("Z\n");
+}
+
+/**
+ * Writes the SVG trailer and flushes the output stream
+ *
+ * @pre     begin() has been called
+ *
+ * @post    trailer and all buffered lines are sent to the output
+ *          stream
+ */
+void SvgWriter::end() {
+   buffer.write("\"/>\n</svg>\n");
+   buffer.flush();
+   output.flush();
+}
+
+/**
+ * Appends a path command holding two integers to the buffer
+ *
+ * @param   command    path command starting the line
+ * @param   xVal       first integer of the line
+ * @param   yVal       second integer of the line
+ */
+void SvgWriter::writeLine(char command, long xVal, long yVal) {
+   buffer.reserveLine();
+   buffer.appendChar(command);
+   buffer.appendInteger(xVal);
+   buffer.appendChar(' ');
+   buffer.appendInteger(yVal);
+   buffer.appendChar('\n');
+} // end SvgWriter.cpp
@@ -0,0 +1,98 @@
+/**
+ * SvgWriter.h
+ *
+ * Declarations for the SvgWriter class, which writes the Points of a
+ * Koch curve to an output stream as an SVG path as they are received.
+ * The page is the 612 x 792 point letter page PostScript draws on,
+ * with the Y axis flipped, and the path steps by the same rounded
+ * integers as the PostScript lines, so both render identically.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <iostream>
+#include "OutputBuffer.h"
+#include "PointSink.h"
+#include "Point.h"
+
+/**
+ * Represents a PointSink that streams a Koch curve as SVG
+ */
+class SvgWriter : public PointSink {
+public:
+   /**
+    * Constructor for SvgWriter class
+    *
+    * @param   output   output stream to write SVG to
+    */
+   explicit SvgWriter(std::ostream& output);
+
+   SvgWriter(const SvgWriter&) = delete;
+   SvgWriter& operator=(const SvgWriter&) = delete;
+
+   /**
+    * Writes the SVG header and the move to the first point
+    *
+    * @pre                 no Points have been added to this writer
+    *
+    * @post                header is sent to the output stream
+    *
+    * @param   firstPoint  first point of the Koch curve
+    * @param   level       Koch level of the curve
+    */
+   void begin(const Point& firstPoint, int level);
+
+   /**
+    * Writes the line to the next Point of the Koch curve. Level 0
+    * curves are written with an absolute L, all other levels with a
+    * relative l from the prior Point.
+    *
+    * @pre              begin() has been called
+    *
+    * @post             line is sent to the output stream
+    *
+    * @param   point    next Point of the Koch curve
+    */
+   void addPoint(const Point& point);
+
+   /**
+    * Writes the Z command that closes the path
+    *
+    * @pre     begin() has been called
+    *
+    * @post    line is sent to the output stream
+    */
+   void closePath();
+
+   /**
+    * Writes the SVG trailer and flushes the output stream
+    *
+    * @pre     begin() has been called
+    *
+    * @post    trailer and all buffered lines are sent to the output
+    *          stream
+    */
+   void end();
+
+private:
+   /**
+    * Appends a path command holding two integers to the buffer
+    *
+    * @param   command    path command starting the line
+    * @param   xVal       first integer of the line
+    * @param   yVal       second integer of the line
+    */
+   void writeLine(char command, long xVal, long yVal);
+
+   /** lines formatted but not yet written to the output stream */
+   OutputBuffer buffer;
+   /** output stream to write SVG to */
+   std::ostream& output;
+   /** true if lines are written with absolute coordinates */
+   bool absolute;
+   /** X coordinate of the prior Point */
+   double priorXCoord;
+   /** Y coordinate of the prior Point */
+   double priorYCoord;
+}; // end SvgWriter.h
@@ -0,0 +1,222 @@
+/**
+ * TemplateCache.cpp
+ *
+ * Implementations for the TemplateCache class, which draws Koch
+ * curves by instancing cached unit curves.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <algorithm>
+#include <stdexcept>
+#include "KochGenerator.h"
+#include "TemplateCache.h"
+
+namespace {
+   /** number of vertices mapped at a time */
+   const long long BLOCK_SIZE = 1024;
+
+   /**
+    * PointSink that appends the points to a template
+    */
+   class TemplateSink : public PointSink {
+   public:
+      TemplateSink(std::vector<double>& us, std::vector<double>& vs) :
+         us(us), vs(vs) {}
+
+      void begin(const Point& firstPoint, int level) {
+         addPoint(firstPoint);
+      }
+
+      void addPoint(const Point& point) {
+         us.push_back(point.getXCoord());
+         vs.push_back(point.getYCoord());
+      }
+
+      void end() {}
+
+   private:
+      /** X coordinates of the template */
+      std::vector<double>& us;
+      /** Y coordinates of the template */
+      std::vector<double>& vs;
+   };
+}
+
+/**
+ * Constructor for TemplateCache class, which maps templates with
+ * the fastest affine kernel the processor supports
+ */
+TemplateCache::TemplateCache() : kernel(bestAffineKernel()) {}
+
+/**
+ * Constructor for TemplateCache class, which maps templates with
+ * the specified affine kernel
+ *
+ * @param   kernelName  "scalar", "sse2" or "avx2"
+ *
+ * @throw   std::invalid_argument if the kernel is unknown or the
+ *          processor does not support it
+ */
+TemplateCache::TemplateCache(const std::string& kernelName) :
+   TemplateCache(kernelName, "") {}
+
+/**
+ * Constructor for TemplateCache class, which maps templates with
+ * the specified affine kernel and keeps them as files in the 
+ * specified directory. Missing or invalid files are generated and
+ * written on first use.
+ *
+ * @param   kernelName  "scalar", "sse2" or "avx2"
+ * @param   directory   existing directory holding template files
+ *
+ * @throw   std::invalid_argument if the kernel is unknown or the
+ *          processor does not support it
+ */
+TemplateCache::TemplateCache(const std::string& kernelName,
+   const std::string& directory) :
+   kernel(findAffineKernel(kernelName)), directory(directory) {
+
+   if (kernel == nullptr) {
+      throw std::invalid_argument("Unsupported kernel " + kernelName);
+   }
+}
+
+/**
+ * Draws the Koch curve of the specified level on a segment into
+ * the specified PointSink. Like KochGenerator::drawKoch only the
+ * points after the first are added, the last being exactly end.
+ * May be called from several threads at once.
+ *
+ * @pre            level is not negative
+ *
+ * @post           template of the level is cached
+ *
+ * @param   start  first point of the segment
+ * @param   end    last point of the segment
+ * @param   level  Koch level to draw
+ * @param   sink   PointSink receiving the points
+ *
+ * @throw   std::runtime_error if a template file cannot be written
+ */
+void TemplateCache::drawKoch(const Point& start, const Point& end,
+   int level, PointSink& sink) {
+
+   if (level <= MAX_TEMPLATE_LEVEL) {
+      instance(getTemplate(level), start, end, sink);
+      return;
+   }
+
+   // split high levels until their pieces have a template
+   Point corners[5] = { start, Point(), Point(), Point(), end };
+   start.kochStep(end, corners[1], corners[2], corners[3]);
+
+   for (int i = 0; i < 4; i++) {
+      drawKoch(corners[i], corners[i + 1], level - 1, sink);
+   }
+}
+
+/**
+ * Retrieves the number of cached templates
+ *
+ * @return  number of levels with a cached unit curve
+ */
+int TemplateCache::getTemplateCount() const {
+   std::lock_guard<std::mutex> guard(lock);
+   return (int) templates.size();
+}
+
+/**
+ * Retrieves the template of the specified level, generating it on
+ * first use
+ *
+ * @param   level  Koch level, at most MAX_TEMPLATE_LEVEL
+ *
+ * @return         the template
+ */
+const TemplateCache::Template& TemplateCache::getTemplate(int level) {
+   std::lock_guard<std::mutex> guard(lock);
+
+   std::unique_ptr<Template>& unit = templates[level];
+   if (unit) {
+      return *unit;
+   }
+
+   std::unique_ptr<Template> created(new Template());
+   if (directory.empty()) {
+      generateTemplate(level, created->ownedUs, created->ownedVs);
+      created->us = created->ownedUs.data();
+      created->vs = created->ownedVs.data();
+      created->vertexCount = created->ownedUs.size();
+   }
+   else {
+      std::string path = TemplateFile::pathFor(directory, level);
+      try {
+         created->file.reset(new TemplateFile(path, level));
+      }
+      catch (const std::runtime_error&) {
+         // missing or damaged files are written again
+         std::vector<double> us;
+         std::vector<double> vs;
+         generateTemplate(level, us, vs);
+         TemplateFile::create(path, level, us, vs);
+         created->file.reset(new TemplateFile(path, level));
+      }
+      created->us = created->file->getXCoords();
+      created->vs = created->file->getYCoords();
+      created->vertexCount = created->file->getVertexCount();
+   }
+
+   unit = std::move(created);
+   return *unit;
+}
+
+/**
+ * Generates the vertices of the unit curve of a level
+ *
+ * @param   level  Koch level of the curve
+ * @param   us     receives X coordinates of the vertices
+ * @param   vs     receives Y coordinates of the vertices
+ */
+void TemplateCache::generateTemplate(int level, std::vector<double>& us,
+   std::vector<double>& vs) {
+
+   us.reserve((1 << (2 * level)) + 1);
+   vs.reserve((1 << (2 * level)) + 1);
+
+   KochGenerator generator(0, 0, 1, 0, level, KochOptions::streamed());
+   TemplateSink sink(us, vs);
+   generator.generate(sink);
+}
+
+/**
+ * Maps a template onto a segment in blocks and adds the points
+ * after the first to the sink
+ *
+ * @param   unit   template to map
+ * @param   start  first point of the segment
+ * @param   end    last point of the segment
+ * @param   sink   PointSink receiving the points
+ */
+void TemplateCache::instance(const Template& unit, const Point& start,
+   const Point& end, PointSink& sink) const {
+
+   double xScale = end.getXCoord() - start.getXCoord();
+   double yScale = end.getYCoord() - start.getYCoord();
+   double xs[BLOCK_SIZE];
+   double ys[BLOCK_SIZE];
+
+   // the first vertex is start and the last is replaced by end, so
+   // that neighbouring segments meet exactly
+   long long last = unit.vertexCount - 1;
+   for (long long first = 1; first < last; first += BLOCK_SIZE) {
+      long long count = std::min(BLOCK_SIZE, last - first);
+      kernel(unit.us + first, unit.vs + first, count,
+         xScale, yScale, start.getXCoord(), start.getYCoord(), xs, ys);
+
+      for (long long i = 0; i < count; i++) {
+         sink.addPoint(Point(xs[i], ys[i]));
+      }
+   }
+   sink.addPoint(end);
+} // end TemplateCache.cpp
@@ -0,0 +1,164 @@
+/**
+ * TemplateCache.h
+ *
+ * Declarations for the TemplateCache class, which draws Koch curves
+ * by instancing cached unit curves. Every Koch curve of one level is
+ * the same shape under a rotation, scaling and translation, so the
+ * curve from (0,0) to (1,0) is generated once per level and any
+ * segment is drawn by mapping its vertices with an AffineKernel.
+ * Levels above MAX_TEMPLATE_LEVEL are split into Koch steps down to
+ * that level first, which keeps the templates small enough to stay
+ * in cache. Templates may be kept in a directory of TemplateFiles,
+ * which are mapped instead of generated when a process starts again.
+ *
+ * The vertices agree with those of KochGenerator::drawKoch within
+ * 1e-12 of the segment length, but are not bit-identical, so a curve
+ * may round to different PostScript integers in rare places.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "KochKernels.h"
+#include "Point.h"
+#include "PointSink.h"
+#include "TemplateFile.h"
+
+/**
+ * Represents a cache of unit Koch curves, one for each level
+ */
+class TemplateCache {
+public:
+   /** highest level whose unit curve is cached */
+   static const int MAX_TEMPLATE_LEVEL = 8;
+
+   /**
+    * Constructor for TemplateCache class, which maps templates with
+    * the fastest affine kernel the processor supports
+    */
+   TemplateCache();
+
+   /**
+    * Constructor for TemplateCache class, which maps templates with
+    * the specified affine kernel
+    *
+    * @param   kernelName  "scalar", "sse2" or "avx2"
+    *
+    * @throw   std::invalid_argument if the kernel is unknown or the
+    *          processor does not support it
+    */
+   explicit TemplateCache(const std::string& kernelName);
+
+   /**
+    * Constructor for TemplateCache class, which maps templates with
+    * the specified affine kernel and keeps them as files in the 
+    * specified directory. Missing or invalid files are generated and
+    * written on first use.
+    *
+    * @param   kernelName  "scalar", "sse2" or "avx2"
+    * @param   directory   existing directory holding template files
+    *
+    * @throw   std::invalid_argument if the kernel is unknown or the
+    *          processor does not support it
+    */
+   TemplateCache(const std::string& kernelName, 
+      const std::string& directory);
+
+   TemplateCache(const TemplateCache&) = delete;
+   TemplateCache& operator=(const TemplateCache&) = delete;
+
+   /**
+    * Draws the Koch curve of the specified level on a segment into
+    * the specified PointSink. Like KochGenerator::drawKoch only the
+    * points after the first are added, the last being exactly end.
+    * May be called from several threads at once.
+    *
+    * @pre            level is not negative
+    *
+    * @post           template of the level is cached
+    *
+    * @param   start  first point of the segment
+    * @param   end    last point of the segment
+    * @param   level  Koch level to draw
+    * @param   sink   PointSink receiving the points
+    *
+    * @throw   std::runtime_error if a template file cannot be written
+    */
+   void drawKoch(const Point& start, const Point& end, int level,
+      PointSink& sink);
+
+   /**
+    * Retrieves the number of cached templates
+    *
+    * @return  number of levels with a cached unit curve
+    */
+   int getTemplateCount() const;
+
+private:
+   /**
+    * Vertices of the Koch curve from (0,0) to (1,0), including both
+    * end points, as structure-of-arrays coordinates held in memory 
+    * or mapped from a file
+    */
+   struct Template {
+      /** X coordinates of the vertices */
+      const double* us;
+      /** Y coordinates of the vertices */
+      const double* vs;
+      /** number of vertices */
+      long long vertexCount;
+      /** X coordinates generated in memory */
+      std::vector<double> ownedUs;
+      /** Y coordinates generated in memory */
+      std::vector<double> ownedVs;
+      /** file the vertices are mapped from, or nullptr */
+      std::unique_ptr<TemplateFile> file;
+   };
+
+   /**
+    * Generates the vertices of the unit curve of a level
+    *
+    * @param   level  Koch level of the curve
+    * @param   us     receives X coordinates of the vertices
+    * @param   vs     receives Y coordinates of the vertices
+    */
+   static void generateTemplate(int level, std::vector<double>& us,
+      std::vector<double>& vs);
+
+   /**
+    * Retrieves the template of the specified level, generating it on
+    * first use
+    *
+    * @param   level  Koch level, at most MAX_TEMPLATE_LEVEL
+    *
+    * @return         the template
+    */
+   const Template& getTemplate(int level);
+
+   /**
+    * Maps a template onto a segment in blocks and adds the points
+    * after the first to the sink
+    *
+    * @param   unit   template to map
+    * @param   start  first point of the segment
+    * @param   end    last point of the segment
+    * @param   sink   PointSink receiving the points
+    */
+   void instance(const Template& unit, const Point& start,
+      const Point& end, PointSink& sink) const;
+
+   /** kernel mapping templates onto segments */
+   AffineKernel kernel;
+   /** directory holding template files, or empty to keep them only
+       in memory */
+   std::string directory;
+   /** guards templates */
+   mutable std::mutex lock;
+   /** unit curve of every level drawn so far */
+   std::map<int, std::unique_ptr<Template>> templates;
+}; // end TemplateCache.h
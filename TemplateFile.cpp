@@ -0,0 +1,213 @@
+/**
+ * TemplateFile.cpp
+ *
+ * Implementations for the TemplateFile class, which memory-maps a
+ * unit Koch curve stored on disk.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "BinaryCurve.h"
+#include "Crc32.h"
+#include "TemplateFile.h"
+
+namespace {
+   /** magic bytes at the start of a template file */
+   const char MAGIC[4] = { 'K', 'T', 'P', 'L' };
+   /** version of the file format */
+   const std::uint8_t VERSION = 2;
+   /** byte order mark, which reads differently in another order */
+   const std::uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+   /**
+    * Fills in the header of a template file
+    */
+   void writeHeader(unsigned char* header, int level,
+      std::uint64_t vertexCount, std::uint32_t vertexCrc) {
+
+      std::uint8_t encoding = FLOAT64;
+      std::int32_t curveLevel = level;
+
+      std::memset(header, 0, TemplateFile::HEADER_SIZE);
+      std::memcpy(header, MAGIC, sizeof(MAGIC));
+      std::memcpy(header + 4, &VERSION, 1);
+      std::memcpy(header + 5, &encoding, 1);
+      std::memcpy(header + 8, &curveLevel, 4);
+      std::memcpy(header + 16, &vertexCount, 8);
+      std::memcpy(header + 24, &BYTE_ORDER_MARK, 8);
+      std::memcpy(header + 32, &vertexCrc, 4);
+   }
+
+   /**
+    * Writes all of the specified bytes to a file, resuming after
+    * partial writes
+    *
+    * @return  true if every byte was written
+    */
+   bool writeAll(int file, const void* data, std::size_t size) {
+      const char* next = (const char*) data;
+
+      while (size > 0) {
+         ssize_t written = write(file, next, size);
+         if (written < 0) {
+            return false;
+         }
+         next += written;
+         size -= written;
+      }
+      return true;
+   }
+}
+
+/**
+ * Retrieves the path of the file holding the specified level in a
+ * directory
+ *
+ * @param   directory  directory holding template files
+ * @param   level      Koch level of the curve
+ *
+ * @return             path of the file
+ */
+std::string TemplateFile::pathFor(const std::string& directory,
+   int level) {
+   return directory + "/koch-" + std::to_string(level) + "-f64.ktpl";
+}
+
+/**
+ * Writes a unit curve to a file atomically, replacing any file
+ * already at the path
+ *
+ * @param   path    path of the file
+ * @param   level   Koch level of the curve
+ * @param   us      X coordinates of the 4^level + 1 vertices
+ * @param   vs      Y coordinates of the vertices
+ *
+ * @throw   std::runtime_error if the file cannot be written
+ */
+void TemplateFile::create(const std::string& path, int level,
+   const std::vector<double>& us, const std::vector<double>& vs) {
+
+   std::size_t coordsSize = us.size() * sizeof(double);
+   std::uint32_t vertexCrc = updateCrc32(0, 
+      (const unsigned char*) us.data(), coordsSize);
+   vertexCrc = updateCrc32(vertexCrc, (const unsigned char*) vs.data(),
+      coordsSize);
+
+   unsigned char header[HEADER_SIZE];
+   writeHeader(header, level, us.size(), vertexCrc);
+
+   // processes racing to create the same file each write their own
+   // temporary file; the last rename wins with identical contents
+   std::string temporary = path + ".tmp" + std::to_string(getpid());
+   int file = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 
+      0644);
+   if (file < 0) {
+      throw std::runtime_error("Cannot write " + temporary);
+   }
+
+   // the contents reach the disk before the rename publishes them, so
+   // a crash cannot leave an empty or partial file under the path
+   bool written = writeAll(file, header, HEADER_SIZE) &&
+      writeAll(file, us.data(), coordsSize) &&
+      writeAll(file, vs.data(), coordsSize) && fsync(file) == 0;
+   if (close(file) != 0 || !written) {
+      std::remove(temporary.c_str());
+      throw std::runtime_error("Cannot write " + temporary);
+   }
+
+   if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+      std::remove(temporary.c_str());
+      throw std::runtime_error("Cannot rename " + temporary);
+   }
+}
+
+/**
+ * Constructor for TemplateFile class, which maps the file and
+ * validates its header, size and vertex checksum
+ *
+ * @param   path    path of the file
+ * @param   level   Koch level the file must hold
+ *
+ * @throw   std::runtime_error if the file is missing, cannot be
+ *          mapped, or its header, size or checksum is invalid
+ */
+TemplateFile::TemplateFile(const std::string& path, int level) :
+   mapping(nullptr), mappingSize(0), vertexCount(0) {
+
+   int file = open(path.c_str(), O_RDONLY);
+   if (file < 0) {
+      throw std::runtime_error("Cannot read " + path);
+   }
+
+   struct stat status;
+   if (fstat(file, &status) != 0 ||
+      (std::size_t) status.st_size < HEADER_SIZE) {
+      close(file);
+      throw std::runtime_error("Invalid template file " + path);
+   }
+
+   mappingSize = status.st_size;
+   mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, file, 0);
+   close(file);
+   if (mapping == MAP_FAILED) {
+      mapping = nullptr;
+      throw std::runtime_error("Cannot map " + path);
+   }
+
+   // the header must be the one this level would be written with,
+   // including the checksum of the vertices actually in the file
+   vertexCount = (1ULL << (2 * level)) + 1;
+   std::size_t coordsSize = 2 * vertexCount * sizeof(double);
+   bool valid = mappingSize == HEADER_SIZE + coordsSize;
+
+   if (valid) {
+      unsigned char expected[HEADER_SIZE];
+      writeHeader(expected, level, vertexCount, updateCrc32(0,
+         (const unsigned char*) mapping + HEADER_SIZE, coordsSize));
+      valid = std::memcmp(mapping, expected, HEADER_SIZE) == 0;
+   }
+   if (!valid) {
+      munmap(mapping, mappingSize);
+      throw std::runtime_error("Invalid template file " + path);
+   }
+}
+
+/**
+ * Destructor for TemplateFile class, which unmaps the file
+ */
+TemplateFile::~TemplateFile() {
+   munmap(mapping, mappingSize);
+}
+
+/**
+ * Retrieves the number of vertices, including both end points
+ *
+ * @return  number of vertices
+ */
+std::uint64_t TemplateFile::getVertexCount() const {
+   return vertexCount;
+}
+
+/**
+ * Retrieves the X coordinates of the vertices inside the mapping
+ *
+ * @return  X coordinates
+ */
+const double* TemplateFile::getXCoords() const {
+   return (const double*) ((const char*) mapping + HEADER_SIZE);
+}
+
+/**
+ * Retrieves the Y coordinates of the vertices inside the mapping
+ *
+ * @return  Y coordinates
+ */
+const double* TemplateFile::getYCoords() const {
+   return getXCoords() + vertexCount;
+} // end TemplateFile.cpp
@@ -0,0 +1,115 @@
+/**
+ * TemplateFile.h
+ *
+ * Declarations for the TemplateFile class, which memory-maps a unit
+ * Koch curve stored on disk so that its vertices are read in place
+ * without copying. One file holds one level at one precision in the
+ * byte order of the machine that wrote it. A 64 byte header
+ *
+ *    offset  0   "KTPL"
+ *    offset  4   uint8    format version, currently 2
+ *    offset  5   uint8    CurveEncoding of the vertices, FLOAT64
+ *    offset  6   uint16   reserved, 0
+ *    offset  8   int32    Koch level
+ *    offset 12   uint32   reserved, 0
+ *    offset 16   uint64   number of vertices, 4^level + 1
+ *    offset 24   uint64   byte order mark 0x0102030405060708
+ *    offset 32   uint32   CRC-32 of the vertex coordinates
+ *    offset 36            zero padding
+ *
+ * is followed by the X coordinates of all vertices and then their Y
+ * coordinates. Files are written under a temporary name, synced to 
+ * disk and renamed into place, so a reader never maps a partly 
+ * written file, and a file damaged later fails its checksum.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Represents a unit Koch curve mapped from a file
+ */
+class TemplateFile {
+public:
+   /** size of the header in bytes */
+   static const std::size_t HEADER_SIZE = 64;
+
+   /**
+    * Retrieves the path of the file holding the specified level in a
+    * directory
+    *
+    * @param   directory  directory holding template files
+    * @param   level      Koch level of the curve
+    *
+    * @return             path of the file
+    */
+   static std::string pathFor(const std::string& directory, int level);
+
+   /**
+    * Writes a unit curve to a file atomically, replacing any file
+    * already at the path
+    *
+    * @param   path    path of the file
+    * @param   level   Koch level of the curve
+    * @param   us      X coordinates of the 4^level + 1 vertices
+    * @param   vs      Y coordinates of the vertices
+    *
+    * @throw   std::runtime_error if the file cannot be written
+    */
+   static void create(const std::string& path, int level,
+      const std::vector<double>& us, const std::vector<double>& vs);
+
+   /**
+    * Constructor for TemplateFile class, which maps the file and
+    * validates its header, size and vertex checksum
+    *
+    * @param   path    path of the file
+    * @param   level   Koch level the file must hold
+    *
+    * @throw   std::runtime_error if the file is missing, cannot be
+    *          mapped, or its header, size or checksum is invalid
+    */
+   TemplateFile(const std::string& path, int level);
+
+   /**
+    * Destructor for TemplateFile class, which unmaps the file
+    */
+   ~TemplateFile();
+
+   TemplateFile(const TemplateFile&) = delete;
+   TemplateFile& operator=(const TemplateFile&) = delete;
+
+   /**
+    * Retrieves the number of vertices, including both end points
+    *
+    * @return  number of vertices
+    */
+   std::uint64_t getVertexCount() const;
+
+   /**
+    * Retrieves the X coordinates of the vertices inside the mapping
+    *
+    * @return  X coordinates
+    */
+   const double* getXCoords() const;
+
+   /**
+    * Retrieves the Y coordinates of the vertices inside the mapping
+    *
+    * @return  Y coordinates
+    */
+   const double* getYCoords() const;
+
+private:
+   /** start of the mapped file */
+   void* mapping;
+   /** size of the mapped file in bytes */
+   std::size_t mappingSize;
+   /** number of vertices */
+   std::uint64_t vertexCount;
+}; // end TemplateFile.h
@@ -0,0 +1,152 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include "Batch.h"
+#include "KochGenerator.h"
+#include "TemplateCache.h"
+
+/**
+ * Reads the whole contents of a file
+ */
+std::string readFile(const std::string& path) {
+   std::ifstream input(path, std::ios::binary);
+   std::ostringstream contents;
+   contents << input.rdbuf();
+   return contents.str();
+}
+
+/**
+ * Runs a job list and retrieves the status line of every job by
+ * line number
+ */
+std::map<int, std::string> runJobs(const std::string& jobList,
+   int threadCount, TemplateCache* templates, int& failures) {
+
+   std::istringstream jobs(jobList);
+   std::ostringstream status;
+   failures = runBatch(jobs, status, threadCount, templates);
+
+   std::map<int, std::string> lines;
+   std::istringstream statusLines(status.str());
+   int lineNumber;
+   std::string message;
+   while (statusLines >> lineNumber && std::getline(statusLines, message)) {
+      assert(lines.count(lineNumber) == 0);
+      lines[lineNumber] = message.substr(1);
+   }
+   return lines;
+}
+
+/**
+ * Tests that a job line is read with and without a format
+ */
+void testParseJob() {
+   BatchJob job = parseBatchJob("72 360 504 360 3 out.ps");
+   assert(job.start.getXCoord() == 72 && job.start.getYCoord() == 360);
+   assert(job.end.getXCoord() == 504 && job.end.getYCoord() == 360);
+   assert(job.level == 3);
+   assert(job.path == "out.ps");
+   assert(job.format == "ps");
+
+   job = parseBatchJob("  0 0 1.5 -2 0 curve.svg svg");
+   assert(job.end.getXCoord() == 1.5 && job.end.getYCoord() == -2);
+   assert(job.format == "svg");
+
+   const char* invalid[] = { "72 360 504 360", "72 360 504 360 -1 a.ps",
+      "72 360 504 360 3 a.ps ps extra", "x 360 504 360 3 a.ps",
+      "72 360 504 360 13 a.ps", "72 360 504 360 3 a.png png" };
+   for (const char* line : invalid) {
+      bool thrown = false;
+      try {
+         parseBatchJob(line);
+      }
+      catch (const std::invalid_argument&) {
+         thrown = true;
+      }
+      assert(thrown);
+   }
+   std::cout << "Passed parse job test" << std::endl;
+}
+
+/**
+ * Tests that every job writes the curve of a single run and that
+ * failed jobs are reported without stopping the others
+ */
+void testRunBatch() {
+   char directory[] = "/tmp/kochBatchXXXXXX";
+   assert(mkdtemp(directory) != nullptr);
+   std::string batch0 = std::string(directory) + "/batch0.ps";
+   std::string batch1 = std::string(directory) + "/batch1.svg";
+   std::string batch2 = std::string(directory) + "/batch2.png";
+   std::string batch4 = std::string(directory) + "/batch4.ps";
+
+   std::string jobList =
+      "# curves of a batch\n"
+      "72 360 504 360 4 " + batch0 + "\n"
+      "\n"
+      "13 -7 611 401 3 " + batch1 + " svg\n"
+      "72 360 504 360 2 " + batch2 + " png\n"
+      "72 360 504 360 two " + directory + "/batch3.ps\n"
+      "72 360 504 360 2 " + directory + "/missing/batch.ps\n"
+      "72 360 504 360 5 " + batch4 + "\n";
+
+   std::ostringstream expected0;
+   expected0 << KochGenerator(72, 360, 504, 360, 4, KochOptions::streamed());
+   std::ostringstream expected4;
+   expected4 << KochGenerator(72, 360, 504, 360, 5, KochOptions::streamed());
+
+   for (int threadCount = 1; threadCount <= 3; threadCount++) {
+      int failures;
+      std::map<int, std::string> lines = runJobs(jobList, threadCount,
+         nullptr, failures);
+
+      assert(failures == 3);
+      assert(lines.size() == 6);
+      assert(lines[2] == "ok\t" + batch0 + "\t257");
+      assert(lines[4] == "ok\t" + batch1 + "\t65");
+      assert(lines[5].compare(0, 6, "error\t") == 0);
+      assert(lines[6].compare(0, 6, "error\t") == 0);
+      assert(lines[7].compare(0, 6, "error\t") == 0);
+      assert(lines[8] == "ok\t" + batch4 + "\t1025");
+
+      assert(readFile(batch0) == expected0.str());
+      assert(readFile(batch4) == expected4.str());
+      assert(readFile(batch1).find("</svg>") != std::string::npos);
+
+      // a job with an unknown format never creates its file
+      assert(!std::ifstream(batch2));
+   }
+
+   // templates shared by all jobs draw the same files
+   TemplateCache templates;
+   int failures;
+   std::map<int, std::string> lines = runJobs(jobList, 2, &templates,
+      failures);
+   assert(failures == 3);
+   assert(readFile(batch0) == expected0.str());
+   assert(templates.getTemplateCount() == 3);
+
+   std::remove(batch0.c_str());
+   std::remove(batch1.c_str());
+   std::remove(batch4.c_str());
+   assert(rmdir(directory) == 0);
+   std::cout << "Passed run batch test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess batch jobs
+ */
+void runAllTests() {
+   testParseJob();
+   testRunBatch();
+}
+
+int main() {
+   runAllTests();
+} // end BatchTest.cpp
@@ -0,0 +1,134 @@
+#include <iostream>
+#include <cassert>
+#include <sstream>
+#include <stdexcept>
+#include "BinaryCurve.h"
+#include "KochGenerator.h"
+#include "PostScriptWriter.h"
+
+/**
+ * Writes a curve in the specified encoding and converts it back
+ * to PostScript
+ */
+std::string roundTrip(const KochGenerator& generator,
+   CurveEncoding encoding) {
+
+   std::stringstream binary;
+   BinaryCurveWriter writer(binary, encoding, generator.getLastPoint(),
+      generator.getPointCount());
+   generator.generate(writer);
+
+   BinaryCurveReader reader(binary);
+   assert(reader.getEncoding() == encoding);
+   assert(reader.getCurveLevel() == generator.getCurveLevel());
+   assert(reader.getPointCount() ==
+      (std::uint64_t) generator.getPointCount());
+
+   std::ostringstream converted;
+   PostScriptWriter postScript(converted);
+   reader.read(postScript);
+   return converted.str();
+}
+
+/**
+ * Tests that the lossless encodings convert back to the PostScript 
+ * of the original curve
+ */
+void testRoundTrip() {
+   for (int level = 0; level <= 5; level++) {
+      KochGenerator generator(13, -7, 611, 401, level, KochOptions::streamed());
+
+      std::ostringstream expected;
+      PostScriptWriter writer(expected);
+      generator.generate(writer);
+
+      assert(roundTrip(generator, DELTA_VARINT) == expected.str());
+      assert(roundTrip(generator, FLOAT64) == expected.str());
+   }
+   std::cout << "Passed round trip test" << std::endl;
+}
+
+/**
+ * Tests that FLOAT64 keeps every coordinate and FLOAT32 rounds each
+ * one to the nearest float
+ */
+void testFloatPoints() {
+   KochGenerator generator(13, -7, 611, 401, 4);
+
+   for (CurveEncoding encoding : { FLOAT32, FLOAT64 }) {
+      std::stringstream binary;
+      BinaryCurveWriter writer(binary, encoding, 
+         generator.getLastPoint(), generator.getPointCount());
+      generator.generate(writer);
+
+      Queue<Point> points;
+      QueueSink sink(points);
+      generator.generate(sink);
+
+      BinaryCurveReader reader(binary);
+      Point point;
+      for (const Point& expected : points) {
+         assert(reader.readPoint(point));
+         double xCoord = expected.getXCoord();
+         double yCoord = expected.getYCoord();
+         if (encoding == FLOAT32) {
+            xCoord = (float) xCoord;
+            yCoord = (float) yCoord;
+         }
+         assert(point.getXCoord() == xCoord);
+         assert(point.getYCoord() == yCoord);
+      }
+      assert(!reader.readPoint(point));
+   }
+   std::cout << "Passed float points test" << std::endl;
+}
+
+/**
+ * Tests that invalid and truncated input is rejected
+ */
+void testInvalidInput() {
+   std::istringstream notCurve("%!PS-Adobe-2.0\n");
+   bool thrown = false;
+   try {
+      BinaryCurveReader reader(notCurve);
+   }
+   catch (const std::runtime_error&) {
+      thrown = true;
+   }
+   assert(thrown);
+
+   KochGenerator generator(0, 0, 300, 0, 3, KochOptions::streamed());
+   std::stringstream binary;
+   BinaryCurveWriter writer(binary, DELTA_VARINT,
+      generator.getLastPoint(), generator.getPointCount());
+   generator.generate(writer);
+
+   std::string bytes = binary.str();
+   std::istringstream truncated(bytes.substr(0, bytes.size() - 1));
+   BinaryCurveReader reader(truncated);
+   Point point;
+
+   thrown = false;
+   try {
+      while (reader.readPoint(point)) {}
+   }
+   catch (const std::runtime_error&) {
+      thrown = true;
+   }
+   assert(thrown);
+   std::cout << "Passed invalid input test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the BinaryCurveWriter and BinaryCurveReader classes
+ */
+void runAllTests() {
+   testRoundTrip();
+   testFloatPoints();
+   testInvalidInput();
+}
+
+int main() {
+   runAllTests();
+} // end BinaryCurveTest.cpp
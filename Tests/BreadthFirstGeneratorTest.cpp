@@ -0,0 +1,62 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include "BreadthFirstGenerator.h"
+#include "KochGenerator.h"
+#include "PointSink.h"
+#include "Queue.h"
+
+/**
+ * Tests that a kernel produces the vertices of the recursive
+ * generator within the documented tolerance
+ */
+void testKernel(const std::string& kernelName) {
+   if (findKochKernel(kernelName) == nullptr) {
+      std::cout << "Skipped " << kernelName << " kernel test" <<
+         std::endl;
+      return;
+   }
+
+   // level 10 spans more than one tile
+   for (int level = 0; level <= 10; level += 5) {
+      KochGenerator recursive(10, 20, 700, -300, level,
+         KochOptions::streamed());
+      BreadthFirstGenerator breadthFirst(10, 20, 700, -300, level,
+         kernelName);
+
+      Queue<Point> expected;
+      Queue<Point> actual;
+      QueueSink expectedSink(expected);
+      QueueSink actualSink(actual);
+      recursive.generate(expectedSink);
+      breadthFirst.generate(actualSink);
+
+      assert(actual.getCurrentSize() == expected.getCurrentSize());
+
+      double tolerance = 1e-12 * hypot(690, 320);
+      while (!expected.isEmpty()) {
+         assert(fabs(actual.front().getXCoord() -
+            expected.front().getXCoord()) <= tolerance);
+         assert(fabs(actual.front().getYCoord() -
+            expected.front().getYCoord()) <= tolerance);
+         actual.pop();
+         expected.pop();
+      }
+   }
+   std::cout << "Passed " << kernelName << " kernel test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the BreadthFirstGenerator class
+ */
+void runAllTests() {
+   testKernel("scalar");
+   testKernel("sse2");
+   testKernel("avx2");
+}
+
+int main() {
+   runAllTests();
+} // end BreadthFirstGeneratorTest.cpp
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "CompactingSink.h"
+#include "KochGenerator.h"
+#include "PointSink.h"
+#include "Queue.h"
+
+/**
+ * Tests that a point lies on the segment between two points
+ */
+bool isOnSegment(const Point& point, const Point& start, 
+   const Point& end) {
+
+   double cross = (end.getXCoord() - start.getXCoord()) *
+      (point.getYCoord() - start.getYCoord()) -
+      (end.getYCoord() - start.getYCoord()) *
+      (point.getXCoord() - start.getXCoord());
+   double dot = (point.getXCoord() - start.getXCoord()) *
+      (end.getXCoord() - point.getXCoord()) +
+      (point.getYCoord() - start.getYCoord()) *
+      (end.getYCoord() - point.getYCoord());
+   return cross == 0 && dot >= 0;
+}
+
+/**
+ * Tests that the compacted curve passes through every rounded point
+ * of the original curve, in order, without zero-length moves or
+ * consecutive moves in one direction
+ */
+void testCompaction() {
+   for (int level = 0; level <= 8; level++) {
+      KochGenerator generator(72, 360, 504, 360, level,
+         KochOptions::streamed());
+
+      Queue<Point> original;
+      QueueSink originalSink(original);
+      generator.generate(originalSink);
+
+      Queue<Point> compacted;
+      QueueSink compactedSink(compacted);
+      CompactingSink compactor(compactedSink);
+      generator.generate(compactor);
+
+      assert(compactor.getReceivedCount() == original.getCurrentSize());
+      assert(compactor.getSentCount() == compacted.getCurrentSize());
+      assert(compacted.getCurrentSize() <= original.getCurrentSize());
+
+      // walk the rounded original points along the compacted path
+      Point start(72, 360);
+      Queue<Point>::const_iterator end = compacted.begin();
+      for (const Point& point : original) {
+         Point rounded(std::round(point.getXCoord()),
+            std::round(point.getYCoord()));
+
+         while (!isOnSegment(rounded, start, *end)) {
+            start = *end;
+            ++end;
+            assert(end != compacted.end());
+         }
+      }
+      assert(compacted.back().getXCoord() == 504);
+      assert(compacted.back().getYCoord() == 360);
+
+      // no move stays in place or continues the prior move
+      Point prior(72, 360);
+      double priorXDelta = 0, priorYDelta = 0;
+      for (const Point& point : compacted) {
+         double xDelta = point.getXCoord() - prior.getXCoord();
+         double yDelta = point.getYCoord() - prior.getYCoord();
+         assert(xDelta != 0 || yDelta != 0);
+         assert(priorXDelta * yDelta != priorYDelta * xDelta ||
+            priorXDelta * xDelta + priorYDelta * yDelta <= 0);
+
+         priorXDelta = xDelta;
+         priorYDelta = yDelta;
+         prior = point;
+      }
+   }
+   std::cout << "Passed compaction test" << std::endl;
+}
+
+/**
+ * Tests that a curve collapsing onto its first point sends nothing
+ */
+void testCollapsedCurve() {
+   KochGenerator generator(10, 10, 10.2, 10.1, 5, KochOptions::streamed());
+
+   Queue<Point> compacted;
+   QueueSink compactedSink(compacted);
+   CompactingSink compactor(compactedSink);
+   generator.generate(compactor);
+
+   assert(compacted.isEmpty());
+   assert(compactor.getReceivedCount() == 1024);
+   std::cout << "Passed collapsed curve test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the CompactingSink class
+ */
+void runAllTests() {
+   testCompaction();
+   testCollapsedCurve();
+}
+
+int main() {
+   runAllTests();
+} // end CompactingSinkTest.cpp
@@ -0,0 +1,164 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "CurveServer.h"
+#include "KochGenerator.h"
+#include "LruCache.h"
+#include "TemplateCache.h"
+
+/**
+ * Retrieves the PostScript of a curve drawn by KochGenerator
+ */
+std::string expectedPostScript(int x1, int y1, int x2, int y2, int level) {
+   std::ostringstream expected;
+   expected << KochGenerator(x1, y1, x2, y2, level, KochOptions::streamed());
+   return expected.str();
+}
+
+/**
+ * Requests a curve and retrieves it as a string
+ */
+std::string request(const std::string& address, const std::string& text) {
+   std::ostringstream output;
+   requestCurve(address, text, output);
+   return output.str();
+}
+
+/**
+ * Tests that the least recently used outputs are evicted first and
+ * that outputs larger than the capacity are not stored
+ */
+void testLruCache() {
+   LruCache cache(25);
+   cache.insert("a", std::make_shared<const std::string>("123456789"));
+   cache.insert("b", std::make_shared<const std::string>("123456789"));
+   assert(cache.getSize() == 20 && cache.getEntryCount() == 2);
+
+   // touching a makes b the least recently used
+   assert(*cache.find("a") == "123456789");
+   cache.insert("c", std::make_shared<const std::string>("123456789"));
+   assert(cache.getEntryCount() == 2);
+   assert(cache.find("b") == nullptr);
+   assert(cache.find("a") != nullptr && cache.find("c") != nullptr);
+
+   // replacing a key keeps one entry for it
+   cache.insert("a", std::make_shared<const std::string>("1"));
+   assert(cache.getSize() == 12 && *cache.find("a") == "1");
+
+   cache.insert("d", 
+      std::make_shared<const std::string>(std::string(30, 'x')));
+   assert(cache.find("d") == nullptr && cache.getEntryCount() == 2);
+   std::cout << "Passed LRU cache test" << std::endl;
+}
+
+/**
+ * Tests that a server answers requests with the curves of a single
+ * run, repeats cached curves and reports errors
+ */
+void testServe(const std::string& address, TemplateCache* templates) {
+   CurveServer server(address, 2, 1 << 20, templates);
+   std::thread serving([&server] { server.serve(); });
+   std::string bound = server.getAddress();
+
+   assert(request(bound, "72 360 504 360 3") == 
+      expectedPostScript(72, 360, 504, 360, 3));
+   assert(request(bound, "72.0 360 504 360 3 ps") == 
+      expectedPostScript(72, 360, 504, 360, 3));
+   assert(server.getMissCount() == 1 && server.getHitCount() == 1);
+
+   // a curve longer than one chunk streams in several
+   assert(request(bound, "13 -7 611 401 7") == 
+      expectedPostScript(13, -7, 611, 401, 7));
+   assert(request(bound, "13 -7 611 401 2 svg").find("</svg>") != 
+      std::string::npos);
+
+   const char* invalid[] = { "72 360 504", "72 360 504 360 3 gif",
+      "72 360 504 360 3 ps extra", "72 360 504 360 99" };
+   for (const char* text : invalid) {
+      bool thrown = false;
+      try {
+         request(bound, text);
+      }
+      catch (const std::runtime_error&) {
+         thrown = true;
+      }
+      assert(thrown);
+   }
+
+   // clients may be served at the same time
+   std::vector<std::thread> clients;
+   for (int i = 0; i < 4; i++) {
+      clients.emplace_back([&bound, i] {
+         assert(request(bound, "0 0 300 " + std::to_string(i) + " 4") ==
+            expectedPostScript(0, 0, 300, i, 4));
+      });
+   }
+   for (std::thread& client : clients) {
+      client.join();
+   }
+
+   server.stop();
+   serving.join();
+}
+
+/**
+ * Tests serving over a Unix socket and over localhost TCP, with and
+ * without templates
+ */
+void testServer() {
+   std::string socketPath = "/tmp/kochServerTest" + 
+      std::to_string(getpid()) + ".sock";
+   testServe("unix:" + socketPath, nullptr);
+   assert(access(socketPath.c_str(), F_OK) != 0);
+
+   testServe("tcp:0", nullptr);
+
+   TemplateCache templates;
+   testServe("tcp:0", &templates);
+
+   bool thrown = false;
+   try {
+      request("unix:" + socketPath, "72 360 504 360 3");
+   }
+   catch (const std::runtime_error&) {
+      thrown = true;
+   }
+   assert(thrown);
+
+   // a file that is not a socket is never removed
+   std::ofstream(socketPath) << "keep";
+   thrown = false;
+   try {
+      CurveServer server("unix:" + socketPath, 1, 1024, nullptr);
+   }
+   catch (const std::runtime_error&) {
+      thrown = true;
+   }
+   assert(thrown);
+   std::ifstream kept(socketPath);
+   std::string contents;
+   assert(kept >> contents && contents == "keep");
+   std::remove(socketPath.c_str());
+   std::cout << "Passed server test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the
+ * CurveServer and LruCache classes
+ */
+void runAllTests() {
+   testLruCache();
+   testServer();
+}
+
+int main() {
+   runAllTests();
+} // end CurveServerTest.cpp
@@ -0,0 +1,188 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "GeneratorRule.h"
+#include "KochGenerator.h"
+#include "Queue.h"
+
+/**
+ * Retrieves the points of a curve after the first
+ */
+Queue<Point> curvePoints(const KochGenerator& generator) {
+   Queue<Point> points;
+   QueueSink sink(points);
+   generator.generate(sink);
+   return points;
+}
+
+/**
+ * Determines if two points are within the specified distance
+ */
+bool near(const Point& point, double xCoord, double yCoord,
+   double tolerance) {
+   return fabs(point.getXCoord() - xCoord) <= tolerance &&
+      fabs(point.getYCoord() - yCoord) <= tolerance;
+}
+
+/**
+ * Tests that the koch rule draws exactly the curve drawn without a
+ * rule and that cesaro:60 is the same shape
+ */
+void testKochRule() {
+   GeneratorRule koch = GeneratorRule::named("koch");
+   assert(koch.isKoch() && koch.getSegmentCount() == 4);
+   assert(koch.getMaxLevel() == 31);
+
+   for (int level = 0; level <= 5; level++) {
+      std::ostringstream expected;
+      expected << KochGenerator(13, -7, 611, 401, level);
+      KochOptions options;
+      options.rule = koch;
+      std::ostringstream actual;
+      actual << KochGenerator(13, -7, 611, 401, level, options);
+      assert(actual.str() == expected.str());
+   }
+
+   GeneratorRule cesaro = GeneratorRule::named("cesaro:60");
+   assert(!cesaro.isKoch());
+   Queue<Point> expected = curvePoints(KochGenerator(13, -7, 611, 401,
+      5, KochOptions::streamed()));
+   KochOptions options = KochOptions::streamed();
+   options.rule = cesaro;
+   Queue<Point> actual = curvePoints(KochGenerator(13, -7, 611, 401,
+      5, options));
+   assert(actual.getCurrentSize() == expected.getCurrentSize());
+
+   Queue<Point>::const_iterator point = expected.begin();
+   for (const Point& actualPoint : actual) {
+      assert(near(actualPoint, point->getXCoord(), point->getYCoord(),
+         1e-9));
+      ++point;
+   }
+   std::cout << "Passed koch rule test" << std::endl;
+}
+
+/**
+ * Tests the corners of one step of every named rule
+ */
+void testCorners() {
+   Point corners[GeneratorRule::MAX_SEGMENTS + 1];
+
+   GeneratorRule::named("levy").split(Point(0, 0), Point(2, 0), corners);
+   assert(near(corners[1], 1, 1, 1e-12));
+   assert(corners[2] == Point(2, 0));
+
+   GeneratorRule quadratic = GeneratorRule::named("quadratic");
+   assert(quadratic.getSegmentCount() == 5);
+   quadratic.split(Point(0, 0), Point(0, 3), corners);
+   assert(near(corners[1], 0, 1, 1e-12));
+   assert(near(corners[2], -1, 1, 1e-12));
+   assert(near(corners[3], -1, 2, 1e-12));
+   assert(near(corners[4], 0, 2, 1e-12));
+
+   GeneratorRule minkowski = GeneratorRule::named("minkowski");
+   assert(minkowski.getSegmentCount() == 8);
+   minkowski.split(Point(0, 0), Point(4, 0), corners);
+   const double expected[][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, 
+      { 2, 1 }, { 2, 0 }, { 2, -1 }, { 3, -1 }, { 3, 0 }, { 4, 0 } };
+   for (int i = 0; i <= 8; i++) {
+      assert(near(corners[i], expected[i][0], expected[i][1], 1e-12));
+   }
+
+   // a custom table is scaled to end at the end of the segment
+   GeneratorRule custom = GeneratorRule::named("1:0,1:90,1:0");
+   custom.split(Point(0, 0), Point(2, 1), corners);
+   assert(near(corners[1], 1, 0, 1e-12));
+   assert(near(corners[2], 1, 1, 1e-12));
+   assert(corners[3] == Point(2, 1));
+   std::cout << "Passed corners test" << std::endl;
+}
+
+/**
+ * Tests that the streaming, stored, parallel, indexed and range
+ * paths agree for rules of other branching factors
+ */
+void testGenerationPaths() {
+   const char* names[] = { "quadratic", "levy", "minkowski", 
+      "cesaro:85" };
+
+   for (const char* name : names) {
+      GeneratorRule rule = GeneratorRule::named(name);
+      int level = rule.getSegmentCount() > 4 ? 3 : 5;
+
+      KochOptions options = KochOptions::streamed();
+      options.rule = rule;
+      KochGenerator streamed(72, 360, 504, 360, level, options);
+      options.threadCount = 3;
+      KochGenerator parallel(72, 360, 504, 360, level, options);
+      options.streaming = false;
+      options.threadCount = 1;
+      KochGenerator stored(72, 360, 504, 360, level, options);
+      assert(streamed.getPointCount() == 
+         rule.countSegments(level) + 1);
+
+      std::ostringstream expected;
+      expected << streamed;
+      std::ostringstream storedOutput;
+      storedOutput << stored;
+      std::ostringstream parallelOutput;
+      parallelOutput << parallel;
+      assert(storedOutput.str() == expected.str());
+      assert(parallelOutput.str() == expected.str());
+
+      Queue<Point> points = curvePoints(streamed);
+      assert(points.getCurrentSize() == streamed.getPointCount() - 1);
+
+      long long index = 1;
+      for (const Point& point : points) {
+         assert(streamed.pointAt(index) == point);
+         index++;
+      }
+
+      Queue<Point> range;
+      QueueSink rangeSink(range);
+      streamed.generateRange(7, 20, rangeSink);
+      assert(range.getCurrentSize() == 13);
+      assert(range.front() == streamed.pointAt(7));
+      assert(range.back() == streamed.pointAt(19));
+   }
+   std::cout << "Passed generation paths test" << std::endl;
+}
+
+/**
+ * Tests that unknown names and invalid tables are rejected
+ */
+void testInvalidRules() {
+   const char* invalid[] = { "dragon", "cesaro:0", "cesaro:120", 
+      "cesaro:", "1:0", "1:0,1:180", "1:0;1:0", "1:0,1" };
+
+   for (const char* name : invalid) {
+      bool thrown = false;
+      try {
+         GeneratorRule::named(name);
+      }
+      catch (const std::invalid_argument&) {
+         thrown = true;
+      }
+      assert(thrown);
+   }
+   std::cout << "Passed invalid rules test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the GeneratorRule class
+ */
+void runAllTests() {
+   testKochRule();
+   testCorners();
+   testGenerationPaths();
+   testInvalidRules();
+}
+
+int main() {
+   runAllTests();
+} // end GeneratorRuleTest.cpp
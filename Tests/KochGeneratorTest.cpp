@@ -0,0 +1,274 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include "KochGenerator.h"
+#include "KochTable.h"
+
+/**
+ * Retrieves the PostScript output of a KochGenerator
+ */
+std::string toPostScript(const KochGenerator& generator) {
+   std::ostringstream output;
+   output << generator;
+   return output.str();
+}
+
+/**
+ * Tests that the first level 1 curve matches the reference output
+ */
+void testLevelOne() {
+   KochGenerator generator(72, 360, 504, 360, 1);
+
+   assert(toPostScript(generator) ==
+      "%!PS-Adobe-2.0\n"
+      "72\t360\tmoveto\n"
+      "144\t0\trlineto\n"
+      "72\t125\trlineto\n"
+      "72\t-125\trlineto\n"
+      "144\t0\trlineto\n"
+      "stroke\n"
+      "showpage\n");
+   std::cout << "Passed level one test" << std::endl;
+}
+
+/**
+ * Tests that streaming output matches stored output
+ */
+void testStreaming() {
+   for (int level = 0; level <= 6; level++) {
+      KochGenerator stored(10, 20, 700, -300, level);
+      KochGenerator streamed(10, 20, 700, -300, level, KochOptions::streamed());
+
+      assert(toPostScript(stored) == toPostScript(streamed));
+   }
+   std::cout << "Passed streaming test" << std::endl;
+}
+
+/**
+ * Tests that output drawn on several threads matches the output of
+ * a single thread
+ */
+void testParallel() {
+   for (int level = 0; level <= 7; level++) {
+      KochGenerator serial(72, 360, 504, 360, level, KochOptions::streamed());
+      std::string expected = toPostScript(serial);
+
+      for (int threads = 2; threads <= 5; threads += 3) {
+         KochOptions options = KochOptions::streamed();
+         options.threadCount = threads;
+         KochGenerator streamed(72, 360, 504, 360, level, options);
+         options.streaming = false;
+         KochGenerator stored(72, 360, 504, 360, level, options);
+
+         assert(toPostScript(streamed) == expected);
+         assert(toPostScript(stored) == expected);
+      }
+   }
+   std::cout << "Passed parallel test" << std::endl;
+}
+
+/**
+ * Tests that every point retrieved by index matches the point drawn
+ * at that index
+ */
+void testPointAt() {
+   KochGenerator generator(10, 20, 700, -300, 5, KochOptions::streamed());
+   Queue<Point> points;
+   QueueSink sink(points);
+   generator.generate(sink);
+
+   assert(generator.getPointCount() == 1025);
+   Point firstPoint = Point(10, 20);
+   Point point = generator.pointAt(0);
+   assert(point == firstPoint);
+
+   for (long long i = 1; i < generator.getPointCount(); i++) {
+      Point expected = points.front();
+      point = generator.pointAt(i);
+      assert(point.getXCoord() == expected.getXCoord());
+      assert(point.getYCoord() == expected.getYCoord());
+      points.pop();
+   }
+   std::cout << "Passed point at test" << std::endl;
+}
+
+/**
+ * Tests that consecutive ranges together generate the whole curve
+ */
+void testGenerateRange() {
+   KochGenerator generator(72, 360, 504, 360, 4, KochOptions::streamed());
+   long long count = generator.getPointCount();
+   long long bounds[] = { 0, 1, 2, 17, 100, 101, 200, count };
+
+   Queue<Point> points;
+   QueueSink sink(points);
+   for (int i = 0; i + 1 < 8; i++) {
+      generator.generateRange(bounds[i], bounds[i + 1], sink);
+      assert(points.getCurrentSize() == bounds[i + 1]);
+   }
+
+   for (long long i = 0; i < count; i++) {
+      Point expected = generator.pointAt(i);
+      assert(points.front().getXCoord() == expected.getXCoord());
+      assert(points.front().getYCoord() == expected.getYCoord());
+      points.pop();
+   }
+
+   // ranges index the full curve even when a resolution is set
+   KochOptions options = KochOptions::streamed();
+   options.resolution = 50;
+   KochGenerator coarse(72, 360, 504, 360, 5, options);
+   coarse.generateRange(3, 700, sink);
+   assert(points.getCurrentSize() == 697);
+   for (long long i = 3; i < 700; i++) {
+      Point expected = coarse.pointAt(i);
+      assert(points.front().getXCoord() == expected.getXCoord());
+      assert(points.front().getYCoord() == expected.getYCoord());
+      points.pop();
+   }
+   std::cout << "Passed generate range test" << std::endl;
+}
+
+/**
+ * Tests that a stored KochGenerator can be output more than once
+ */
+void testRepeatedOutput() {
+   KochGenerator generator(72, 360, 504, 360, 4);
+   std::string first = toPostScript(generator);
+
+   assert(toPostScript(generator) == first);
+   assert(generator.getPointCount() == 257);
+   std::cout << "Passed repeated output test" << std::endl;
+}
+
+/**
+ * Tests that a resolution stops dividing segments once they are
+ * shorter than it, on one or several threads
+ */
+void testResolution() {
+   KochGenerator full(72, 360, 504, 360, 6, KochOptions::streamed());
+   KochOptions options = KochOptions::streamed();
+   options.resolution = 0;
+   KochGenerator noResolution(72, 360, 504, 360, 6, options);
+   assert(toPostScript(noResolution) == toPostScript(full));
+
+   options.resolution = 2;
+   KochGenerator coarse(72, 360, 504, 360, 14, options);
+   Queue<Point> points;
+   QueueSink sink(points);
+   coarse.generate(sink);
+
+   // every segment is shorter than the resolution, but its parent 
+   // segment was not
+   Point prior = coarse.getFirstPoint();
+   for (const Point& point : points) {
+      double length = hypot(point.getXCoord() - prior.getXCoord(),
+         point.getYCoord() - prior.getYCoord());
+      assert(length < 2 && length >= 2.0 / 3 - 1e-9);
+      prior = point;
+   }
+   assert(points.back().getXCoord() == 504);
+   assert(points.getCurrentSize() < 1 << 12);
+
+   options.streaming = false;
+   options.threadCount = 3;
+   KochGenerator parallel(72, 360, 504, 360, 14, options);
+   assert(toPostScript(parallel) == toPostScript(coarse));
+   std::cout << "Passed resolution test" << std::endl;
+}
+
+/**
+ * Tests that small curves mapped from their KochTable agree with the
+ * recursion and with every other way of drawing them, and that only
+ * tabled curves are mapped
+ */
+void testKochTable() {
+   static_assert(KochTable<3>::VERTEX_COUNT == 65, "4^3 + 1 vertices");
+
+   for (int level = 0; level <= MAX_TABLE_LEVEL; level++) {
+      KochOptions options = KochOptions::streamed();
+      options.tabled = true;
+      KochGenerator unit(0, 0, 1, 0, level, options);
+      KochGenerator tabled(13, -7, 611, 401, level, options);
+
+      Queue<Point> unitPoints;
+      QueueSink unitSink(unitPoints);
+      unit.generate(unitSink);
+      Queue<Point> points;
+      QueueSink sink(points);
+      tabled.generate(sink);
+      Queue<Point> recursive;
+      QueueSink recursiveSink(recursive);
+      tabled.drawKoch(13, -7, 611, 401, level, recursiveSink);
+      assert(points.getCurrentSize() == recursive.getCurrentSize());
+
+      // the unit curve is exactly the table
+      long long index = 1;
+      for (const Point& point : unitPoints) {
+         assert(point == Point(kochTableXCoords(level)[index], 
+            kochTableYCoords(level)[index]));
+         index++;
+      }
+
+      index = 1;
+      Queue<Point>::const_iterator expected = recursive.begin();
+      for (const Point& point : points) {
+         assert(fabs(point.getXCoord() - expected->getXCoord()) < 1e-9);
+         assert(fabs(point.getYCoord() - expected->getYCoord()) < 1e-9);
+         assert(tabled.pointAt(index) == point);
+         ++expected;
+         index++;
+      }
+      assert(points.back() == tabled.getLastPoint());
+
+      options.streaming = false;
+      options.threadCount = 3;
+      KochGenerator parallel(13, -7, 611, 401, level, options);
+      assert(toPostScript(parallel) == toPostScript(tabled));
+
+      Queue<Point> range;
+      QueueSink rangeSink(range);
+      tabled.generateRange(0, tabled.getPointCount(), rangeSink);
+      assert(range.getCurrentSize() == tabled.getPointCount());
+      assert(range.front() == tabled.getFirstPoint());
+      assert(range.back() == tabled.getLastPoint());
+   }
+
+   // curves are only mapped when asked to, so by default they are
+   // exactly the recursive curve
+   KochGenerator plain(-279, 619, 576, 619, 2, KochOptions::streamed());
+   Queue<Point> points;
+   QueueSink sink(points);
+   plain.generate(sink);
+   Queue<Point> recursive;
+   QueueSink recursiveSink(recursive);
+   plain.drawKoch(-279, 619, 576, 619, 2, recursiveSink);
+
+   Queue<Point>::const_iterator expected = recursive.begin();
+   for (const Point& point : points) {
+      assert(point == *expected);
+      ++expected;
+   }
+   std::cout << "Passed koch table test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the KochGenerator class
+ */
+void runAllTests() {
+   testLevelOne();
+   testStreaming();
+   testParallel();
+   testPointAt();
+   testGenerateRange();
+   testRepeatedOutput();
+   testResolution();
+   testKochTable();
+}
+
+int main() {
+   runAllTests();
+} // end KochGeneratorTest.cpp
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "KochGenerator.h"
+#include "PolygonGenerator.h"
+#include "PostScriptWriter.h"
+
+/**
+ * Retrieves the PostScript output of a PolygonGenerator
+ */
+std::string toPostScript(const PolygonGenerator& generator) {
+   std::ostringstream output;
+   PostScriptWriter writer(output);
+   generator.generate(writer);
+   return output.str();
+}
+
+/**
+ * Tests that a polyline of one side is the plain Koch curve
+ */
+void testSingleSide() {
+   std::vector<Point> vertices{ Point(72, 360), Point(504, 360) };
+
+   for (int level = 0; level <= 5; level++) {
+      PolygonGenerator polyline(vertices, false, level);
+      KochGenerator curve(72, 360, 504, 360, level, KochOptions::streamed());
+
+      std::ostringstream expected;
+      expected << curve;
+      assert(toPostScript(polyline) == expected.str());
+   }
+   std::cout << "Passed single side test" << std::endl;
+}
+
+/**
+ * Tests that a snowflake writes every vertex once, bumps outwards 
+ * and ends with closepath
+ */
+void testSnowflake() {
+   std::vector<Point> triangle = PolygonGenerator::snowflake(
+      Point(100, 300), Point(500, 300));
+   assert(triangle.size() == 3);
+   assert(fabs(triangle[2].getXCoord() - 300) < 1e-9);
+   assert(fabs(triangle[2].getYCoord() - (300 - 200 * sqrt(3))) < 1e-9);
+
+   PolygonGenerator snowflake(triangle, true, 3);
+   Queue<Point> points;
+   QueueSink sink(points);
+   snowflake.generate(sink);
+
+   // the first vertex is not repeated at the end
+   assert(points.getCurrentSize() == 3 * 64 - 1);
+   assert(points.back().getXCoord() != 100 || 
+      points.back().getYCoord() != 300);
+
+   // the tip of the first side points away from the third vertex
+   PolygonGenerator firstLevel(triangle, true, 1);
+   Queue<Point> corners;
+   QueueSink cornerSink(corners);
+   firstLevel.generate(cornerSink);
+   Queue<Point>::const_iterator tip = corners.begin();
+   ++tip;
+   assert(tip->getYCoord() > 300);
+
+   std::string postScript = toPostScript(snowflake);
+   assert(postScript.find("closepath\nstroke\nshowpage\n") != 
+      std::string::npos);
+   std::cout << "Passed snowflake test" << std::endl;
+}
+
+/**
+ * Tests that sides split into subtrees drawn on several threads
+ * produce the same path, with and without a resolution
+ */
+void testParallel() {
+   std::vector<Point> vertices{ Point(50, 50), Point(550, 50), 
+      Point(550, 700), Point(50, 700) };
+
+   for (int closed = 0; closed <= 1; closed++) {
+      PolygonGenerator serial(vertices, closed, 5);
+      PolygonGenerator parallel(vertices, closed, 5, 3, 0);
+      assert(toPostScript(parallel) == toPostScript(serial));
+
+      PolygonGenerator coarse(vertices, closed, 7, 1, 3);
+      PolygonGenerator coarseParallel(vertices, closed, 7, 8, 3);
+      assert(toPostScript(coarseParallel) == toPostScript(coarse));
+   }
+   std::cout << "Passed parallel test" << std::endl;
+}
+
+/**
+ * Tests that initiators with too few vertices are rejected
+ */
+void testTooFewVertices() {
+   std::vector<Point> vertices{ Point(0, 0), Point(10, 0) };
+   bool thrown = false;
+
+   try {
+      PolygonGenerator polygon(vertices, true, 2);
+   }
+   catch (const std::invalid_argument&) {
+      thrown = true;
+   }
+   assert(thrown);
+   std::cout << "Passed too few vertices test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the PolygonGenerator class
+ */
+void runAllTests() {
+   testSingleSide();
+   testSnowflake();
+   testParallel();
+   testTooFewVertices();
+}
+
+int main() {
+   runAllTests();
+} // end PolygonGeneratorTest.cpp
@@ -0,0 +1,192 @@
+#include <iostream>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <stdexcept>
+#include "KochGenerator.h"
+#include "PrecisionGenerator.h"
+#include "Queue.h"
+
+/**
+ * Retrieves the largest error of float coordinates against double 
+ * ones, one float epsilon of the curve length per level
+ */
+double floatBound(double length, int level) {
+   return level * FLT_EPSILON * length;
+}
+
+/**
+ * Retrieves the largest error of FixedPoint coordinates against 
+ * double ones, one raw unit per level and one for the rounding of
+ * the tip, whatever the curve length
+ */
+double fixedBound(int level) {
+   return (level + 1) * std::ldexp(1.0, -FixedPoint::FRACTION_BITS);
+}
+
+/**
+ * Retrieves the points after the first of a curve drawn in double
+ * precision by the KochGenerator recursion
+ */
+Queue<Point> referencePoints(double x1, double y1, double x2, double y2,
+   int level) {
+   Queue<Point> points;
+   QueueSink sink(points);
+   KochGenerator(x1, y1, x2, y2, 0).drawKoch(x1, y1, x2, y2, level, sink);
+   return points;
+}
+
+/**
+ * Retrieves the largest distance along either axis between the 
+ * points of a curve and the reference points
+ */
+template <typename Coord>
+double largestError(const PrecisionGenerator<Coord>& generator,
+   const Queue<Point>& reference) {
+   Queue<BasicPoint<Coord> > points;
+   BasicQueueSink<Coord> sink(points);
+   generator.generate(sink);
+   assert(points.getCurrentSize() == reference.getCurrentSize());
+
+   double error = 0;
+   Queue<Point>::const_iterator expected = reference.begin();
+   for (const BasicPoint<Coord>& point : points) {
+      error = std::fmax(error, std::fmax(
+         std::fabs((double) point.getXCoord() - expected->getXCoord()),
+         std::fabs((double) point.getYCoord() - expected->getYCoord())));
+      ++expected;
+   }
+   return error;
+}
+
+/**
+ * Tests that double coordinates reproduce the KochGenerator exactly
+ */
+void testDouble() {
+   for (int level = 0; level <= 7; level++) {
+      Queue<Point> reference = referencePoints(13, -7, 611, 401, level);
+      PrecisionGenerator<double> streamed(13, -7, 611, 401, level, true);
+      PrecisionGenerator<double> stored(13, -7, 611, 401, level, false);
+
+      assert(largestError(streamed, reference) == 0);
+      assert(largestError(stored, reference) == 0);
+      assert(streamed.getPointCount() == 
+         (long long) reference.getCurrentSize() + 1);
+   }
+   std::cout << "Passed double test" << std::endl;
+}
+
+/**
+ * Tests that float and FixedPoint coordinates stay within their 
+ * error bounds of the double reference
+ */
+void testNarrowCoordinates() {
+   const double curves[][4] = { { 13, -7, 611, 401 }, 
+      { -20000, -5000, 20000, 8000 }, { 0.5, 0.25, 3.75, -1 } };
+
+   for (const double* ends : curves) {
+      double length = std::hypot(ends[2] - ends[0], ends[3] - ends[1]);
+
+      for (int level = 0; level <= 8; level++) {
+         Queue<Point> reference = referencePoints(ends[0], ends[1], 
+            ends[2], ends[3], level);
+         PrecisionGenerator<float> narrow(ends[0], ends[1], ends[2], 
+            ends[3], level, false);
+         PrecisionGenerator<FixedPoint> fixed(ends[0], ends[1], ends[2],
+            ends[3], level, false);
+
+         assert(largestError(narrow, reference) <= 
+            floatBound(length, level));
+         assert(largestError(fixed, reference) <= fixedBound(level));
+      }
+   }
+
+   // the ends are stored to within the precision of the coordinates
+   PrecisionGenerator<FixedPoint> fixed(0.25, -3, 1000.5, 2, 4, true);
+   assert((double) fixed.getFirstPoint().getXCoord() == 0.25);
+   assert((double) fixed.getLastPoint().getXCoord() == 1000.5);
+   std::cout << "Passed narrow coordinates test" << std::endl;
+}
+
+/**
+ * Tests the storage and range of FixedPoint coordinates
+ */
+void testFixedPoint() {
+   static_assert(sizeof(BasicPoint<float>) == 8, "two floats");
+   static_assert(sizeof(BasicPoint<FixedPoint>) == 8, "two int32s");
+
+   assert(FixedPoint(1.5).getRaw() == 3 << 15);
+   assert(FixedPoint(-2).getRaw() == -2 << 16);
+   assert((double) FixedPoint::fromRaw(1) == std::ldexp(1.0, -16));
+   assert((double) FixedPoint(-FixedPoint::LIMIT) == -FixedPoint::LIMIT);
+
+   bool thrown = false;
+   try {
+      FixedPoint(FixedPoint::LIMIT + 1);
+   }
+   catch (const std::invalid_argument&) {
+      thrown = true;
+   }
+   assert(thrown);
+
+   // the tip of this curve rises above the range
+   thrown = false;
+   try {
+      PrecisionGenerator<FixedPoint>(0, 30000, 10000, 30000, 3, true);
+   }
+   catch (const std::invalid_argument&) {
+      thrown = true;
+   }
+   assert(thrown);
+
+   // float coordinates have a range too
+   thrown = false;
+   try {
+      PrecisionGenerator<float>(0, 0, 1e39, 0, 1, true);
+   }
+   catch (const std::invalid_argument&) {
+      thrown = true;
+   }
+   assert(thrown);
+   std::cout << "Passed fixed point test" << std::endl;
+}
+
+/**
+ * Tests that a ConvertingSink hands the points of a narrow curve to
+ * a PointSink unchanged
+ */
+void testConvertingSink() {
+   PrecisionGenerator<FixedPoint> fixed(13, -7, 611, 401, 4, false);
+   Queue<BasicPoint<FixedPoint> > narrow;
+   BasicQueueSink<FixedPoint> narrowSink(narrow);
+   fixed.generate(narrowSink);
+
+   Queue<Point> wide;
+   QueueSink wideSink(wide);
+   ConvertingSink<FixedPoint> sink(wideSink);
+   fixed.generate(sink);
+
+   assert(wide.getCurrentSize() == narrow.getCurrentSize());
+   Queue<Point>::const_iterator point = wide.begin();
+   for (const BasicPoint<FixedPoint>& expected : narrow) {
+      assert(point->getXCoord() == (double) expected.getXCoord());
+      assert(point->getYCoord() == (double) expected.getYCoord());
+      ++point;
+   }
+   std::cout << "Passed converting sink test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the PrecisionGenerator class
+ */
+void runAllTests() {
+   testDouble();
+   testNarrowCoordinates();
+   testFixedPoint();
+   testConvertingSink();
+}
+
+int main() {
+   runAllTests();
+} // end PrecisionGeneratorTest.cpp
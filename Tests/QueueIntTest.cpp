@@ -2,7 +2,9 @@
 #include <cassert>
 #include "Queue.h"
 #include <cmath>
+#include <memory>
 #include <string>
+#include <utility>
 
 /**
  * Tests Queue constructor
@@ -185,6 +187,191 @@ void testCopyConstructorOrder() {
    std::cout << "Passed copy constructor order test" << std::endl;
 }
 
+/**
+ * Tests reserve method of Queue class
+ */
+void testReserve() {
+   Queue<int> testList;
+
+   assert(testList.reserve(100) == true);
+   assert(testList.getCapacity() >= 100);
+   assert(testList.isEmpty());
+
+   testList.push(5);
+   testList.push(6);
+
+   // reserving less than the capacity keeps the entries
+   assert(testList.reserve(1) == true);
+   assert(testList.getCapacity() >= 100);
+   assert(testList.front() == 5);
+   assert(testList.back() == 6);
+   std::cout << "Passed reserve test" << std::endl;
+}
+
+/**
+ * Tests ordering of entries once the front of the Queue has wrapped
+ * around the end of its buffer and the buffer is grown
+ */
+void testWrapAround() {
+   Queue<int> testList;
+   testList.reserve(4);
+   int capacity = testList.getCapacity();
+
+   for (int i = 0; i < capacity; i++) {
+      testList.push(i);
+   }
+
+   // free the front half, then fill it again from the back
+   for (int i = 0; i < capacity / 2; i++) {
+      assert(testList.pop() == true);
+   }
+   for (int i = capacity; i < capacity + capacity / 2; i++) {
+      testList.push(i);
+   }
+   assert(testList.getCapacity() == capacity);
+
+   // grow while wrapped around
+   testList.push(capacity + capacity / 2);
+   assert(testList.getCapacity() > capacity);
+
+   for (int i = capacity / 2; i <= capacity + capacity / 2; i++) {
+      assert(testList.front() == i);
+      assert(testList.pop() == true);
+   }
+   assert(testList.isEmpty());
+   std::cout << "Passed wrap around test" << std::endl;
+}
+
+/**
+ * Tests that iterating over a wrapped around Queue visits the entries
+ * from front to back without removing them
+ */
+void testIterator() {
+   Queue<int> testList;
+   assert(testList.begin() == testList.end());
+
+   testList.reserve(4);
+   int capacity = testList.getCapacity();
+   for (int i = 0; i < capacity; i++) {
+      testList.push(i);
+   }
+   for (int i = 0; i < capacity / 2; i++) {
+      testList.pop();
+   }
+   for (int i = capacity; i < capacity + capacity / 2; i++) {
+      testList.push(i);
+   }
+
+   int expected = capacity / 2;
+   for (int entry : testList) {
+      assert(entry == expected);
+      expected++;
+   }
+   assert(expected == capacity + capacity / 2);
+   assert(testList.getCurrentSize() == capacity);
+   std::cout << "Passed iterator test" << std::endl;
+}
+
+/**
+ * Tests copy assignment, including assignment over a non-empty Queue
+ */
+void testCopyAssignment() {
+   Queue<int> testList;
+   testList.push(3);
+   testList.push(-2);
+
+   Queue<int> secondTestList;
+   secondTestList.push(100);
+   secondTestList = testList;
+
+   assert(secondTestList.getCurrentSize() == 2);
+   assert(secondTestList.front() == 3);
+   assert(secondTestList.back() == -2);
+   assert(testList.getCurrentSize() == 2);
+
+   secondTestList = secondTestList;
+   assert(secondTestList.getCurrentSize() == 2);
+   std::cout << "Passed copy assignment test" << std::endl;
+}
+
+/**
+ * Tests that moving a Queue hands over its buffer and leaves the
+ * source empty
+ */
+void testMove() {
+   Queue<int> testList;
+   for (int i = 0; i < 20; i++) {
+      testList.push(i);
+   }
+   const int* firstEntry = &testList.front();
+
+   Queue<int> secondTestList = std::move(testList);
+   assert(testList.isEmpty());
+   assert(testList.getCapacity() == 0);
+   assert(&secondTestList.front() == firstEntry);
+
+   Queue<int> thirdTestList;
+   thirdTestList.push(-1);
+   thirdTestList = std::move(secondTestList);
+   assert(secondTestList.isEmpty());
+   assert(thirdTestList.getCurrentSize() == 20);
+   assert(&thirdTestList.front() == firstEntry);
+   assert(thirdTestList.back() == 19);
+
+   // a moved-from Queue can be used again
+   testList.push(7);
+   assert(testList.front() == 7);
+   std::cout << "Passed move test" << std::endl;
+}
+
+/**
+ * Tests that move-only entries can be pushed, emplaced, modified
+ * through front() and back(), and survive growing the buffer
+ */
+void testMoveOnlyEntries() {
+   Queue<std::unique_ptr<int> > testList;
+
+   testList.push(std::unique_ptr<int>(new int(1)));
+   for (int i = 2; i <= 40; i++) {
+      testList.emplace(new int(i));
+   }
+
+   *testList.front() = 10;
+   *testList.back() += 100;
+   assert(*testList.front() == 10);
+   assert(*testList.back() == 140);
+
+   std::unique_ptr<int> first = std::move(testList.front());
+   assert(*first == 10);
+   assert(testList.pop() == true);
+   assert(*testList.front() == 2);
+   std::cout << "Passed move-only entries test" << std::endl;
+}
+
+/**
+ * Tests that pushing an entry of the Queue itself is safe when the
+ * push grows the buffer
+ */
+void testPushOwnEntry() {
+   Queue<std::string> testList;
+   testList.push(std::string(40, 'a'));
+   while (testList.getCurrentSize() < testList.getCapacity()) {
+      testList.push(std::string(40, 'b'));
+   }
+
+   // the buffer is full, so each push reallocates
+   testList.push(testList.front());
+   assert(testList.back() == std::string(40, 'a'));
+
+   while (testList.getCurrentSize() < testList.getCapacity()) {
+      testList.push(std::string(40, 'b'));
+   }
+   testList.emplace(testList.back());
+   assert(testList.back() == std::string(40, 'b'));
+   assert(testList.front() == std::string(40, 'a'));
+   std::cout << "Passed push own entry test" << std::endl;
+}
+
 /**
  * A single method with all of the tests used to assess structure
  * and feature requirements of Queue classes
@@ -199,6 +386,13 @@ void runAllTests() {
    testPop();
    testOrder();
    testCopyConstructorOrder();
+   testReserve();
+   testWrapAround();
+   testIterator();
+   testCopyAssignment();
+   testMove();
+   testMoveOnlyEntries();
+   testPushOwnEntry();
 }
 
 int main() {
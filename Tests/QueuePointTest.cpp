@@ -2,6 +2,8 @@
 #include <cassert>
 #include "Queue.h"
 #include "Point.h"
+#include "Node.h"
+#include "Arena.h"
 #include <cmath>
 #include <string>
 
@@ -219,6 +221,37 @@ void testCopyConstructorOrder() {
    std::cout << "Passed copy constructor order test" << std::endl;
 }
 
+/**
+ * Tests Queue and Node storage drawn from a MonotonicArena
+ */
+void testArenaAllocator() {
+   MonotonicArena arena(4096);
+   ArenaAllocator<Point> allocator(arena);
+   Queue<Point, ArenaAllocator<Point> > testList(allocator);
+
+   testList.reserve(1000);
+   for (int i = 0; i < 1000; i++) {
+      testList.push(Point(i, -i));
+   }
+   Point lastPoint = Point(999, -999);
+   assert(testList.back() == lastPoint);
+   assert(arena.getSlabCount() == 1);
+
+   // Node slots come from the same slabs
+   ArenaAllocator<Node<Point> > nodeAllocator(allocator);
+   Node<Point>* firstNode = nodeAllocator.allocate(1);
+   Node<Point>* secondNode = nodeAllocator.allocate(1);
+   new (firstNode) Node<Point>(Point(1, 2), secondNode);
+   new (secondNode) Node<Point>(Point(3, 4));
+   assert(firstNode->getNext() == secondNode);
+   assert(secondNode->getItem().getXCoord() == 3);
+
+   testList.clear();
+   arena.clear();
+   assert(arena.getSlabCount() == 0);
+   std::cout << "Passed arena allocator test" << std::endl;
+}
+
 /**
  * A single method with all of the tests used to assess structure
  * and feature requirements of Queue classes
@@ -233,6 +266,7 @@ void runAllTests() {
    testPop();
    testOrder();
    testCopyConstructorOrder();
+   testArenaAllocator();
 }
 
 int main() {
@@ -0,0 +1,78 @@
+#include <iostream>
+#include <cassert>
+#include <sstream>
+#include <string>
+#include "Crc32.h"
+#include "KochGenerator.h"
+#include "PngEncoder.h"
+#include "Rasterizer.h"
+
+/**
+ * Tests that a level 0 curve is drawn as a flipped horizontal line
+ */
+void testLine() {
+   KochGenerator generator(72, 360, 504, 360, 0, KochOptions::streamed());
+   Rasterizer image(generator, 72, 1);
+
+   assert(image.getWidth() == 612);
+   assert(image.getHeight() == 792);
+   for (int column = 72; column <= 504; column++) {
+      assert(image.getPixel(column, 432) == 0);
+      assert(image.getPixel(column, 431) == 255);
+   }
+   assert(image.getPixel(71, 432) == 255);
+   assert(image.getPixel(505, 432) == 255);
+   std::cout << "Passed line test" << std::endl;
+}
+
+/**
+ * Tests that the bands drawn on several threads make up the image
+ * drawn on one thread
+ */
+void testBands() {
+   KochGenerator generator(10, 20, 600, 700, 8, KochOptions::streamed());
+   Rasterizer single(generator, 100, 1);
+   Rasterizer banded(generator, 100, 3);
+
+   std::ostringstream singlePgm, bandedPgm;
+   single.writePgm(singlePgm);
+   banded.writePgm(bandedPgm);
+
+   assert(singlePgm.str().compare(0, 15, "P5\n850 1100\n255") == 0);
+   assert(singlePgm.str() == bandedPgm.str());
+   std::cout << "Passed bands test" << std::endl;
+}
+
+/**
+ * Tests the checksums and the layout of the PNG encoder
+ */
+void testPng() {
+   const unsigned char digits[] = "123456789";
+   assert(updateCrc32(0, digits, 9) == 0xcbf43926u);
+   const unsigned char word[] = "Wikipedia";
+   assert(updateAdler32(1, word, 9) == 0x11e60398u);
+
+   unsigned char pixels[] = { 0, 255, 255, 0 };
+   std::ostringstream output;
+   writePng(output, 2, 2, pixels);
+
+   std::string png = output.str();
+   assert(png.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0);
+   assert(png.compare(12, 4, "IHDR") == 0);
+   assert(png.compare(png.size() - 8, 4, "IEND") == 0);
+   std::cout << "Passed PNG test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the Rasterizer class and the PNG encoder
+ */
+void runAllTests() {
+   testLine();
+   testBands();
+   testPng();
+}
+
+int main() {
+   runAllTests();
+} // end RasterizerTest.cpp
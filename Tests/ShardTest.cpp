@@ -0,0 +1,116 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "GeneratorRule.h"
+#include "KochGenerator.h"
+#include "Shard.h"
+
+/**
+ * Writes every shard of a curve to a file in the specified directory
+ * and retrieves the paths of the files
+ */
+std::vector<std::string> writeShards(const KochGenerator& generator,
+   int shardCount, const std::string& directory, const std::string& name) {
+
+   std::vector<std::string> paths;
+   for (int i = 0; i < shardCount; i++) {
+      paths.push_back(directory + "/" + name + std::to_string(i));
+      std::ofstream shard(paths.back());
+      writeShard(generator, i, shardCount, shard);
+   }
+   return paths;
+}
+
+/**
+ * Merges shards and retrieves the PostScript, or an empty string if
+ * the shards are rejected
+ */
+std::string merge(const std::vector<std::string>& paths) {
+   std::ostringstream output;
+   try {
+      mergeShards(paths, output);
+   }
+   catch (const std::runtime_error&) {
+      return "";
+   }
+   return output.str();
+}
+
+/**
+ * Tests that the shards of a curve merge, in any order, into the
+ * PostScript of the whole curve
+ */
+void testMerge(const std::string& directory) {
+   KochGenerator generator(13, -7, 611, 401, 4, KochOptions::streamed());
+   std::ostringstream expected;
+   expected << generator;
+
+   for (int shardCount = 1; shardCount <= 5; shardCount++) {
+      std::vector<std::string> paths = writeShards(generator,
+         shardCount, directory, "curve");
+      assert(merge(paths) == expected.str());
+
+      std::vector<std::string> reversed(paths.rbegin(), paths.rend());
+      assert(merge(reversed) == expected.str());
+
+      for (const std::string& path : paths) {
+         std::remove(path.c_str());
+      }
+   }
+   std::cout << "Passed merge test" << std::endl;
+}
+
+/**
+ * Tests that shards of different curves of one level are not merged
+ */
+void testMismatchedShards(const std::string& directory) {
+   KochGenerator generator(72, 360, 504, 360, 3, KochOptions::streamed());
+   KochGenerator moved(72, 360, 504, 361, 3, KochOptions::streamed());
+   KochOptions options = KochOptions::streamed();
+   options.rule = GeneratorRule::named("quadratic");
+   KochGenerator quadratic(72, 360, 504, 360, 3, options);
+
+   std::vector<std::string> paths = writeShards(generator, 2,
+      directory, "curve");
+   std::vector<std::string> movedPaths = writeShards(moved, 2,
+      directory, "moved");
+   std::vector<std::string> quadraticPaths = writeShards(quadratic, 2,
+      directory, "quadratic");
+
+   assert(merge(paths) != "");
+   assert(merge({ paths[0], movedPaths[1] }) == "");
+   assert(merge({ quadraticPaths[0], paths[1] }) == "");
+   assert(merge({ paths[0], paths[0] }) == "");
+
+   for (const std::vector<std::string>* set :
+      { &paths, &movedPaths, &quadraticPaths }) {
+      for (const std::string& path : *set) {
+         std::remove(path.c_str());
+      }
+   }
+   std::cout << "Passed mismatched shards test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess writing and
+ * merging shards
+ */
+void runAllTests() {
+   char directory[] = "/tmp/kochShardsXXXXXX";
+   assert(mkdtemp(directory) != nullptr);
+
+   testMerge(directory);
+   testMismatchedShards(directory);
+   assert(rmdir(directory) == 0);
+}
+
+int main() {
+   runAllTests();
+} // end ShardTest.cpp
@@ -0,0 +1,229 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "KochGenerator.h"
+#include "KochKernels.h"
+#include "PolygonGenerator.h"
+#include "Queue.h"
+#include "TemplateCache.h"
+#include "TemplateFile.h"
+#include <unistd.h>
+
+/**
+ * Retrieves the points a TemplateCache draws on a segment after the
+ * first
+ */
+Queue<Point> instancePoints(TemplateCache& templates, const Point& start,
+   const Point& end, int level) {
+
+   Queue<Point> points;
+   QueueSink sink(points);
+   templates.drawKoch(start, end, level, sink);
+   return points;
+}
+
+/**
+ * Asserts that two curves have the same number of points and that
+ * each pair of points is within the specified distance
+ */
+void assertClose(const Queue<Point>& actual, const Queue<Point>& expected,
+   double tolerance) {
+
+   assert(actual.getCurrentSize() == expected.getCurrentSize());
+
+   Queue<Point>::const_iterator point = expected.begin();
+   for (const Point& actualPoint : actual) {
+      assert(fabs(actualPoint.getXCoord() - point->getXCoord()) <=
+         tolerance);
+      assert(fabs(actualPoint.getYCoord() - point->getYCoord()) <=
+         tolerance);
+      ++point;
+   }
+}
+
+/**
+ * Tests that instanced curves agree with the recursive curves on
+ * segments in every direction, including levels above the largest
+ * template
+ */
+void testMatchesRecursion() {
+   TemplateCache templates;
+   const double segments[][4] = {
+      { 72, 360, 504, 360 }, { 13, -7, 611, 401 },
+      { 500, 300, 100, 300 }, { 250, 700, 250, 10 } };
+
+   for (const double* segment : segments) {
+      double length = hypot(segment[2] - segment[0],
+         segment[3] - segment[1]);
+
+      for (int level = 0; level <= TemplateCache::MAX_TEMPLATE_LEVEL + 1;
+         level++) {
+         KochGenerator generator(segment[0], segment[1], segment[2],
+            segment[3], level, KochOptions::streamed());
+         Queue<Point> expected;
+         QueueSink sink(expected);
+         generator.generate(sink);
+
+         Queue<Point> actual = instancePoints(templates,
+            generator.getFirstPoint(), generator.getLastPoint(), level);
+         assertClose(actual, expected, 1e-12 * length);
+
+         // the end point is exact, so neighbouring segments meet
+         assert(actual.back() == generator.getLastPoint());
+      }
+   }
+   assert(templates.getTemplateCount() ==
+      TemplateCache::MAX_TEMPLATE_LEVEL + 1);
+   std::cout << "Passed matches recursion test" << std::endl;
+}
+
+/**
+ * Tests that every kernel the processor supports produces the same
+ * points
+ */
+void testKernels() {
+   TemplateCache scalar("scalar");
+   Queue<Point> expected = instancePoints(scalar, Point(13, -7),
+      Point(611, 401), 5);
+
+   const char* names[] = { "sse2", "avx2" };
+   for (const char* name : names) {
+      if (findAffineKernel(name) == nullptr) {
+         continue;
+      }
+
+      TemplateCache templates(name);
+      assertClose(instancePoints(templates, Point(13, -7),
+         Point(611, 401), 5), expected, 0);
+   }
+
+   bool thrown = false;
+   try {
+      TemplateCache unknown("neon");
+   }
+   catch (const std::invalid_argument&) {
+      thrown = true;
+   }
+   assert(thrown);
+   std::cout << "Passed kernels test" << std::endl;
+}
+
+/**
+ * Tests that a polygon drawn from templates matches the recursive
+ * polygon, serially and in parallel
+ */
+void testPolygon() {
+   TemplateCache templates;
+   std::vector<Point> triangle = PolygonGenerator::snowflake(
+      Point(100, 300), Point(500, 300));
+   PolygonGenerator recursive(triangle, true, 4);
+
+   Queue<Point> expected;
+   QueueSink expectedSink(expected);
+   recursive.generate(expectedSink);
+
+   for (int threadCount = 1; threadCount <= 3; threadCount++) {
+      PolygonGenerator instanced(triangle, true, 4, threadCount,
+         templates);
+
+      Queue<Point> actual;
+      QueueSink actualSink(actual);
+      instanced.generate(actualSink);
+      assertClose(actual, expected, 1e-12 * 400);
+   }
+   assert(templates.getTemplateCount() == 1);
+   std::cout << "Passed polygon test" << std::endl;
+}
+
+/**
+ * Tests that templates are written to a directory, mapped back by a
+ * later cache and written again when their header or vertices are
+ * damaged
+ */
+void testTemplateFiles() {
+   char directory[] = "/tmp/kochTemplatesXXXXXX";
+   assert(mkdtemp(directory) != nullptr);
+   std::string path = TemplateFile::pathFor(directory, 3);
+
+   Queue<Point> expected;
+   {
+      TemplateCache writing("scalar", directory);
+      expected = instancePoints(writing, Point(13, -7), 
+         Point(611, 401), 3);
+   }
+   std::ifstream written(path, std::ios::binary | std::ios::ate);
+   assert(written && written.tellg() == (std::streamoff)
+      (TemplateFile::HEADER_SIZE + 2 * 65 * sizeof(double)));
+   written.close();
+
+   {
+      TemplateFile file(path, 3);
+      assert(file.getVertexCount() == 65);
+      assert(file.getXCoords()[64] == 1 && file.getYCoords()[64] == 0);
+
+      TemplateCache mapping("scalar", directory);
+      assertClose(instancePoints(mapping, Point(13, -7), 
+         Point(611, 401), 3), expected, 0);
+   }
+
+   // a file of another level, a damaged header or damaged vertices
+   // are rejected
+   bool thrown = false;
+   try {
+      TemplateFile wrongLevel(path, 4);
+   }
+   catch (const std::runtime_error&) {
+      thrown = true;
+   }
+   assert(thrown);
+
+   for (std::size_t offset : { (std::size_t) 8, 
+      TemplateFile::HEADER_SIZE + 100 * sizeof(double) }) {
+      {
+         std::fstream damaged(path, 
+            std::ios::binary | std::ios::in | std::ios::out);
+         damaged.seekp(offset);
+         damaged.put(7);
+      }
+      thrown = false;
+      try {
+         TemplateFile file(path, 3);
+      }
+      catch (const std::runtime_error&) {
+         thrown = true;
+      }
+      assert(thrown);
+
+      {
+         TemplateCache repairing("scalar", directory);
+         assertClose(instancePoints(repairing, Point(13, -7), 
+            Point(611, 401), 3), expected, 0);
+      }
+      TemplateFile repaired(path, 3);
+      assert(repaired.getVertexCount() == 65);
+   }
+
+   std::remove(path.c_str());
+   rmdir(directory);
+   std::cout << "Passed template files test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the TemplateCache class
+ */
+void runAllTests() {
+   testMatchesRecursion();
+   testKernels();
+   testPolygon();
+   testTemplateFiles();
+}
+
+int main() {
+   runAllTests();
+} // end TemplateCacheTest.cpp
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <cassert>
+#include <sstream>
+#include <string>
+#include "KochGenerator.h"
+#include "PdfWriter.h"
+#include "PointSink.h"
+#include "PostScriptWriter.h"
+#include "SvgWriter.h"
+
+/**
+ * Tests that the SVG path flips the Y axis of the PostScript page
+ */
+void testSvg() {
+   KochGenerator generator(72, 360, 504, 360, 1, KochOptions::streamed());
+   std::ostringstream output;
+   SvgWriter writer(output);
+   generator.generate(writer);
+
+   std::string svg = output.str();
+   assert(svg.find("viewBox=\"0 0 612 792\"") != std::string::npos);
+   assert(svg.find("M72 432\nl144 0\nl72 -125\nl72 125\nl144 0\n") !=
+      std::string::npos);
+   assert(svg.substr(svg.size() - 11) == "\"/>\n</svg>\n");
+   std::cout << "Passed SVG test" << std::endl;
+}
+
+/**
+ * Tests that the PDF path follows the PostScript pen and that the
+ * cross-reference table points at the objects
+ */
+void testPdf() {
+   KochGenerator generator(72, 360, 504, 360, 1, KochOptions::streamed());
+   std::ostringstream output;
+   PdfWriter writer(output);
+   generator.generate(writer);
+
+   std::string pdf = output.str();
+   std::size_t streamStart = pdf.find("stream\n") + 7;
+   std::size_t streamEnd = pdf.find("endstream");
+   std::string content = pdf.substr(streamStart, streamEnd - streamStart);
+   assert(content == "72 360 m\n216 360 l\n288 485 l\n360 360 l\n"
+      "504 360 l\nS\n");
+
+   std::size_t xref = pdf.rfind("\nxref\n") + 1;
+   assert(pdf.find("startxref\n" + std::to_string(xref)) !=
+      std::string::npos);
+
+   for (int object = 1; object <= 5; object++) {
+      std::size_t entry = xref + 9 + 20 * object;
+      std::size_t offset = std::stoul(pdf.substr(entry, 10));
+      assert(pdf.compare(offset, 7, std::to_string(object) + " 0 obj") ==
+         0);
+   }
+   assert(pdf.find("5 0 obj\n" + std::to_string(content.size())) !=
+      std::string::npos);
+   std::cout << "Passed PDF test" << std::endl;
+}
+
+/**
+ * Tests that a TeeSink writes the same curve as separate writers
+ */
+void testTee() {
+   KochGenerator generator(10, 20, 700, -300, 4, KochOptions::streamed());
+
+   std::ostringstream postScript, svg, teePostScript, teeSvg;
+   PostScriptWriter postScriptWriter(postScript);
+   SvgWriter svgWriter(svg);
+   generator.generate(postScriptWriter);
+   generator.generate(svgWriter);
+
+   PostScriptWriter teePostScriptWriter(teePostScript);
+   SvgWriter teeSvgWriter(teeSvg);
+   TeeSink tee({ &teePostScriptWriter, &teeSvgWriter });
+   generator.generate(tee);
+
+   assert(teePostScript.str() == postScript.str());
+   assert(teeSvg.str() == svg.str());
+   std::cout << "Passed tee test" << std::endl;
+}
+
+/**
+ * A single method with all of the tests used to assess the output
+ * of the SvgWriter, PdfWriter and TeeSink classes
+ */
+void runAllTests() {
+   testSvg();
+   testPdf();
+   testTee();
+}
+
+int main() {
+   runAllTests();
+} // end WriterTest.cpp
@@ -0,0 +1,190 @@
+/**
+ * ThreadPool.cpp
+ *
+ * Implementations for the ThreadPool class, which runs submitted
+ * tasks on a fixed number of worker threads. Every worker owns a
+ * deque of tasks; it runs its own tasks newest first and, when its
+ * deque is empty, steals the oldest task from another worker.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#include "ThreadPool.h"
+
+namespace {
+   /** pool of the current worker thread, otherwise nullptr */
+   thread_local const ThreadPool* currentPool = nullptr;
+   /** index of the current worker thread within currentPool */
+   thread_local int currentWorker = -1;
+}
+
+/**
+ * Constructor for ThreadPool class, which starts the workers
+ *
+ * @param   threadCount   number of worker threads, at least 1
+ */
+ThreadPool::ThreadPool(int threadCount) :
+   queuedTasks(0), pendingTasks(0), nextQueue(0), stopping(false) {
+
+   if (threadCount < 1) {
+      threadCount = 1;
+   }
+
+   for (int i = 0; i < threadCount; i++) {
+      queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+   }
+   for (int i = 0; i < threadCount; i++) {
+      workers.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+   }
+}
+
+/**
+ * Destructor for ThreadPool class that waits for all submitted
+ * tasks and then stops and joins the workers.
+ */
+ThreadPool::~ThreadPool() {
+   wait();
+   {
+      std::lock_guard<std::mutex> guard(stateLock);
+      stopping = true;
+   }
+   taskQueued.notify_all();
+
+   for (std::thread& worker : workers) {
+      worker.join();
+   }
+}
+
+/**
+ * Adds a task to the pool. Tasks submitted from a worker go to
+ * that worker's own deque; other tasks are spread across workers.
+ *
+ * @pre            ThreadPool must be initialized
+ *
+ * @post           task will be run by one of the workers
+ *
+ * @param   task   task to run
+ */
+void ThreadPool::submit(std::function<void()> task) {
+   int index;
+   {
+      std::lock_guard<std::mutex> guard(stateLock);
+      if (currentPool == this) {
+         index = currentWorker;
+      }
+      else {
+         index = nextQueue;
+         nextQueue = (nextQueue + 1) % (int) queues.size();
+      }
+      pendingTasks++;
+   }
+
+   {
+      std::lock_guard<std::mutex> guard(queues[index]->lock);
+      queues[index]->tasks.push_back(std::move(task));
+   }
+
+   {
+      std::lock_guard<std::mutex> guard(stateLock);
+      queuedTasks++;
+   }
+   taskQueued.notify_one();
+}
+
+/**
+ * Blocks until every submitted task has finished
+ *
+ * @pre     must not be called from a worker of this pool
+ *
+ * @post    no tasks are queued or running
+ */
+void ThreadPool::wait() {
+   std::unique_lock<std::mutex> guard(stateLock);
+   tasksFinished.wait(guard, [this] { return pendingTasks == 0; });
+}
+
+/**
+ * Retrieves the number of worker threads
+ *
+ * @pre     ThreadPool must be initialized
+ *
+ * @post    state of this ThreadPool does not change
+ *
+ * @return  number of worker threads
+ */
+int ThreadPool::getThreadCount() const {
+   return (int) workers.size();
+}
+
+/**
+ * Runs tasks on the worker with the specified index until the
+ * pool stops
+ *
+ * @param   index   index of the worker
+ */
+void ThreadPool::workerLoop(int index) {
+   currentPool = this;
+   currentWorker = index;
+
+   while (true) {
+      {
+         // sleep until some deque holds a task
+         std::unique_lock<std::mutex> guard(stateLock);
+         taskQueued.wait(guard, [this] {
+            return queuedTasks > 0 || stopping;
+         });
+         if (queuedTasks == 0 && stopping) {
+            return;
+         }
+      }
+
+      std::function<void()> task;
+      if (!takeTask(index, task)) {
+         // another worker took the task first
+         continue;
+      }
+
+      task();
+
+      std::lock_guard<std::mutex> guard(stateLock);
+      pendingTasks--;
+      if (pendingTasks == 0) {
+         tasksFinished.notify_all();
+      }
+   }
+}
+
+/**
+ * Takes the next task for a worker: the newest task of its own
+ * deque, otherwise the oldest task of another worker's deque
+ *
+ * @param   index   index of the worker
+ * @param   task    receives the task taken
+ *
+ * @return          true if a task was taken, false otherwise
+ */
+bool ThreadPool::takeTask(int index, std::function<void()>& task) {
+   int queueCount = (int) queues.size();
+
+   for (int i = 0; i < queueCount; i++) {
+      WorkQueue& queue = *queues[(index + i) % queueCount];
+      std::lock_guard<std::mutex> guard(queue.lock);
+
+      if (queue.tasks.empty()) {
+         continue;
+      }
+      if (i == 0) {
+         task = std::move(queue.tasks.back());
+         queue.tasks.pop_back();
+      }
+      else {
+         task = std::move(queue.tasks.front());
+         queue.tasks.pop_front();
+      }
+
+      std::lock_guard<std::mutex> stateGuard(stateLock);
+      queuedTasks--;
+      return true;
+   }
+   return false;
+} // end ThreadPool.cpp
@@ -0,0 +1,122 @@
+/**
+ * ThreadPool.h
+ *
+ * Declarations for the ThreadPool class, which runs submitted tasks
+ * on a fixed number of worker threads. Every worker owns a deque of
+ * tasks; it runs its own tasks newest first and, when its deque is
+ * empty, steals the oldest task from another worker.
+ *
+ * Joshua Scheck
+ * 2026-10-17
+ */
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Represents a work-stealing pool of worker threads
+ */
+class ThreadPool {
+public:
+   /**
+    * Constructor for ThreadPool class, which starts the workers
+    *
+    * @param   threadCount   number of worker threads, at least 1
+    */
+   explicit ThreadPool(int threadCount);
+
+   /**
+    * Destructor for ThreadPool class that waits for all submitted
+    * tasks and then stops and joins the workers.
+    */
+   ~ThreadPool();
+
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   /**
+    * Adds a task to the pool. Tasks submitted from a worker go to
+    * that worker's own deque; other tasks are spread across workers.
+    *
+    * @pre            ThreadPool must be initialized
+    *
+    * @post           task will be run by one of the workers
+    *
+    * @param   task   task to run
+    */
+   void submit(std::function<void()> task);
+
+   /**
+    * Blocks until every submitted task has finished
+    *
+    * @pre     must not be called from a worker of this pool
+    *
+    * @post    no tasks are queued or running
+    */
+   void wait();
+
+   /**
+    * Retrieves the number of worker threads
+    *
+    * @pre     ThreadPool must be initialized
+    *
+    * @post    state of this ThreadPool does not change
+    *
+    * @return  number of worker threads
+    */
+   int getThreadCount() const;
+
+private:
+   /**
+    * Deque of tasks owned by one worker
+    */
+   struct WorkQueue {
+      /** guards tasks */
+      std::mutex lock;
+      /** tasks waiting to run */
+      std::deque<std::function<void()> > tasks;
+   };
+
+   /**
+    * Runs tasks on the worker with the specified index until the
+    * pool stops
+    *
+    * @param   index   index of the worker
+    */
+   void workerLoop(int index);
+
+   /**
+    * Takes the next task for a worker: the newest task of its own
+    * deque, otherwise the oldest task of another worker's deque
+    *
+    * @param   index   index of the worker
+    * @param   task    receives the task taken
+    *
+    * @return          true if a task was taken, false otherwise
+    */
+   bool takeTask(int index, std::function<void()>& task);
+
+   /** deque of every worker */
+   std::vector<std::unique_ptr<WorkQueue> > queues;
+   /** worker threads */
+   std::vector<std::thread> workers;
+   /** guards the counters and the stopping flag */
+   std::mutex stateLock;
+   /** signalled when a task is queued or the pool stops */
+   std::condition_variable taskQueued;
+   /** signalled when the last pending task finishes */
+   std::condition_variable tasksFinished;
+   /** number of tasks sitting in deques */
+   int queuedTasks;
+   /** number of tasks submitted but not yet finished */
+   int pendingTasks;
+   /** deque receiving the next task submitted from outside */
+   int nextQueue;
+   /** true once the workers should exit */
+   bool stopping;
+}; // end ThreadPool.h
@@ -0,0 +1,17 @@
+#!/bin/bash
+# build and run the microbenchmarks, writing JSON to standard output
+#
+#    ./bench_script.sh [--quick] [--compare baseline.json [--tolerance P]]
+#
+# keep a baseline with ./bench_script.sh > bench_baseline.json, outside
+# version control since the numbers belong to one machine; with
+# --compare the script fails if a benchmark got more than P percent
+# (50 by default, above the noise of repeat runs) worse than the
+# baseline
+g++ -std=c++17 -O2 -pthread -I. -o bench_runner Bench/Benchmark.cpp \
+   $(ls *.cpp | grep -v Main.cpp) || exit 1
+
+./bench_runner "$@"
+status=$?
+rm -f bench_runner
+exit $status
@@ -1,5 +1,5 @@
 #!/bin/bash
-g++ -std=c++11 -o koch *.cpp
+g++ -std=c++17 -pthread -o koch *.cpp
 
 # output test.ps file
 ./koch 72 360 504 360 1 > test.ps
@@ -9,6 +9,13 @@ valgrind --leak-check=full ./koch 72 360 504 360 1 > valgrind-out.txt 2>&1
 NOLEAKMSG="in use at exit: 0 bytes in 0 blocks"
 grep "$NOLEAKMSG" valgrind-out.txt
 
+# build and run unit tests
+for test in Tests/*Test.cpp; do
+   g++ -std=c++17 -pthread -I. -o test_runner $test \
+      $(ls *.cpp | grep -v Main.cpp) && ./test_runner || exit 1
+done
+rm -f test_runner
+
 
 #valgrind --leak-check=full \
 #         --show-leak-kinds=all \